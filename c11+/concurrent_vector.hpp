@@ -0,0 +1,504 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace ft
+{
+
+/// Grow-only vector for many appending threads.
+///
+/// Appends reserve indices with one fetch_add and construct into power-of-two segments
+/// that are never moved or freed while the container lives; a segment is installed by
+/// whichever thread needs it first (CAS, the loser frees its copy). An element becomes
+/// visible once it and every element before it are constructed: size() is that published
+/// prefix, so operator[] below size() and iteration up to end() are safe while other
+/// threads append. Destruction, clear, swap and assignment are not concurrent.
+///
+/// If an element's constructor throws, its indices are handed back when no later append
+/// has reserved past them; otherwise they become dead slots. Publication moves past dead
+/// slots and iterators step over them, so size(), operator[] and iterator arithmetic count
+/// slots while stepping counts elements; hence the iterators are bidirectional. at() throws
+/// std::out_of_range on a dead slot.
+template <typename TType, typename TAllocator = std::allocator<TType>>
+class concurrent_vector
+{
+public:
+    using value_type = TType;
+    using allocator_type = TAllocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = typename std::allocator_traits<TAllocator>::pointer;
+    using const_pointer = typename std::allocator_traits<TAllocator>::const_pointer;
+
+    template <bool Const>
+    class Iterator;
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    using alloc_traits = std::allocator_traits<allocator_type>;
+    using flag_type = std::atomic<unsigned char>;
+    using flag_allocator = typename alloc_traits::template rebind_alloc<flag_type>;
+    using flag_traits = std::allocator_traits<flag_allocator>;
+
+    static constexpr size_type first_segment_bits = 5;
+    static constexpr size_type first_segment_size = size_type(1) << first_segment_bits;
+    static constexpr size_type max_segments = std::numeric_limits<size_type>::digits - first_segment_bits;
+
+    static constexpr unsigned char slot_empty = 0;
+    static constexpr unsigned char slot_ready = 1;
+    static constexpr unsigned char slot_dead = 2; /// reserved, but its constructor threw
+
+    allocator_type m_Allocator;
+    std::atomic<pointer> m_Segments[max_segments];
+    std::atomic<flag_type*> m_States[max_segments];
+    std::atomic<size_type> m_Reserved;
+    std::atomic<size_type> m_Published;
+
+public:
+    concurrent_vector() : concurrent_vector(allocator_type()) {}
+
+    explicit concurrent_vector(const allocator_type& alloc)
+        : m_Allocator(alloc)
+        , m_Reserved(0)
+        , m_Published(0)
+    {
+        for (size_type k = 0; k < max_segments; ++k)
+        {
+            m_Segments[k].store(nullptr, std::memory_order_relaxed);
+            m_States[k].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    concurrent_vector(size_type count, const value_type& value, const allocator_type& alloc = allocator_type())
+        : concurrent_vector(alloc)
+    {
+        grow_by(count, value);
+    }
+
+    concurrent_vector(const concurrent_vector& other) /// copies the prefix other has published so far
+        : concurrent_vector(alloc_traits::select_on_container_copy_construction(other.m_Allocator))
+    {
+        const_iterator last = other.end();
+        reserve(last.index());
+        for (const_iterator it = other.begin(); it != last; ++it)
+        {
+            push_back(*it);
+        }
+    }
+
+    concurrent_vector& operator=(const concurrent_vector& other)
+    {
+        if (&other != this)
+        {
+            concurrent_vector copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    ~concurrent_vector()
+    {
+        clear();
+        for (size_type k = 0; k < max_segments; ++k)
+        {
+            free_segment(k);
+        }
+    }
+
+    allocator_type get_allocator() const
+    {
+        return m_Allocator;
+    }
+
+    // iterator methods, end() is fixed at the published size when called
+    iterator begin() noexcept { return iterator(this, skip_dead(0)); }
+    const_iterator begin() const noexcept { return const_iterator(this, skip_dead(0)); }
+    iterator end() noexcept { return iterator(this, size()); }
+    const_iterator end() const noexcept { return const_iterator(this, size()); }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // capacity methods
+    size_type size() const noexcept { return m_Published.load(std::memory_order_acquire); }
+    bool empty() const noexcept { return size() == 0; }
+    size_type max_size() const noexcept { return alloc_traits::max_size(m_Allocator); }
+
+    size_type capacity() const noexcept
+    {
+        size_type total = 0;
+        for (size_type k = 0; k < max_segments && m_Segments[k].load(std::memory_order_acquire) != nullptr; ++k)
+        {
+            total += segment_size(k);
+        }
+        return total;
+    }
+
+    void reserve(size_type new_capacity) /// allocates segments up front, safe to call while appending
+    {
+        if (new_capacity > max_size())
+        {
+            throw std::length_error("reserve of concurrent_vector: new capacity is too much");
+        }
+        if (new_capacity != 0)
+        {
+            ensure_segments(0, new_capacity);
+        }
+    }
+
+    // element access methods, wait-free for indices below size()
+    reference operator[](size_type position) noexcept { return *slot(position); }
+    const_reference operator[](size_type position) const noexcept { return *slot(position); }
+
+    reference at(size_type position)
+    {
+        if (position >= size() || is_dead(position))
+        {
+            throw std::out_of_range("out of range of concurrent_vector");
+        }
+        return *slot(position);
+    }
+
+    const_reference at(size_type position) const
+    {
+        if (position >= size() || is_dead(position))
+        {
+            throw std::out_of_range("out of range of concurrent_vector");
+        }
+        return *slot(position);
+    }
+
+    reference front() { return *slot(0); }
+    const_reference front() const { return *slot(0); }
+    reference back() { return *slot(size() - 1); }
+    const_reference back() const { return *slot(size() - 1); }
+
+    // modifiers methods, lock-free
+    iterator push_back(const value_type& val) { return emplace_back(val); }
+    iterator push_back(value_type&& val) { return emplace_back(std::move(val)); }
+
+    template <typename... Args>
+    iterator emplace_back(Args&&... args)
+    {
+        size_type idx = m_Reserved.fetch_add(1, std::memory_order_relaxed);
+        try
+        {
+            ensure_segments(idx, idx + 1);
+            alloc_traits::construct(m_Allocator, slot(idx), std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            abandon(idx, idx + 1);
+            throw;
+        }
+        publish(idx, idx + 1, slot_ready);
+        return iterator(this, idx);
+    }
+
+    iterator grow_by(size_type count) /// appends count value-initialized elements as one contiguous range of indices
+    {
+        return grow_with(count, [this](pointer p) { alloc_traits::construct(m_Allocator, p); });
+    }
+
+    iterator grow_by(size_type count, const value_type& val)
+    {
+        return grow_with(count, [this, &val](pointer p) { alloc_traits::construct(m_Allocator, p, val); });
+    }
+
+    void swap(concurrent_vector& other) noexcept
+    {
+        using std::swap;
+        swap(m_Allocator, other.m_Allocator);
+        for (size_type k = 0; k < max_segments; ++k)
+        {
+            m_Segments[k].store(other.m_Segments[k].exchange(m_Segments[k].load()));
+            m_States[k].store(other.m_States[k].exchange(m_States[k].load()));
+        }
+        m_Reserved.store(other.m_Reserved.exchange(m_Reserved.load()));
+        m_Published.store(other.m_Published.exchange(m_Published.load()));
+    }
+
+    void clear() noexcept /// keeps the segments
+    {
+        size_type reserved = m_Reserved.load();
+        for (size_type i = 0; i < reserved; ++i)
+        {
+            flag_type* state = slot_state(i);
+            if (state != nullptr)
+            {
+                if (state->load(std::memory_order_relaxed) == slot_ready)
+                {
+                    alloc_traits::destroy(m_Allocator, slot(i));
+                }
+                state->store(slot_empty, std::memory_order_relaxed);
+            }
+        }
+        m_Reserved.store(0);
+        m_Published.store(0);
+    }
+
+private:
+    static size_type segment_of(size_type position) noexcept
+    {
+        size_type shifted = position + first_segment_size;
+        return std::numeric_limits<size_type>::digits - 1 - __builtin_clzll(shifted) - first_segment_bits;
+    }
+
+    static size_type segment_base(size_type k) noexcept { return (first_segment_size << k) - first_segment_size; }
+    static size_type segment_size(size_type k) noexcept { return first_segment_size << k; }
+
+    pointer slot(size_type position) const noexcept
+    {
+        size_type k = segment_of(position);
+        return m_Segments[k].load(std::memory_order_acquire) + (position - segment_base(k));
+    }
+
+    flag_type* slot_state(size_type position) const noexcept
+    {
+        size_type k = segment_of(position);
+        flag_type* flags = m_States[k].load(std::memory_order_acquire);
+        return flags == nullptr ? nullptr : flags + (position - segment_base(k));
+    }
+
+    /// Installs the segments covering [first, last)
+    void ensure_segments(size_type first, size_type last)
+    {
+        for (size_type k = segment_of(first); k <= segment_of(last - 1); ++k)
+        {
+            if (m_Segments[k].load(std::memory_order_acquire) == nullptr)
+            {
+                install_segment(k);
+            }
+        }
+    }
+
+    void install_segment(size_type k)
+    {
+        flag_allocator flag_alloc(m_Allocator);
+        if (m_States[k].load(std::memory_order_acquire) == nullptr)
+        {
+            flag_type* flags = flag_traits::allocate(flag_alloc, segment_size(k));
+            for (size_type i = 0; i < segment_size(k); ++i)
+            {
+                flag_traits::construct(flag_alloc, flags + i, slot_empty);
+            }
+            flag_type* expected = nullptr;
+            if (!m_States[k].compare_exchange_strong(expected, flags, std::memory_order_acq_rel))
+            {
+                flag_traits::deallocate(flag_alloc, flags, segment_size(k));
+            }
+        }
+        pointer data = alloc_traits::allocate(m_Allocator, segment_size(k));
+        pointer expected = nullptr;
+        if (!m_Segments[k].compare_exchange_strong(expected, data, std::memory_order_acq_rel))
+        {
+            alloc_traits::deallocate(m_Allocator, data, segment_size(k));
+        }
+    }
+
+    void free_segment(size_type k)
+    {
+        pointer data = m_Segments[k].load();
+        if (data != nullptr)
+        {
+            alloc_traits::deallocate(m_Allocator, data, segment_size(k));
+        }
+        flag_type* flags = m_States[k].load();
+        if (flags != nullptr)
+        {
+            flag_allocator flag_alloc(m_Allocator);
+            flag_traits::deallocate(flag_alloc, flags, segment_size(k));
+        }
+    }
+
+    template <typename TConstruct>
+    iterator grow_with(size_type count, TConstruct construct)
+    {
+        size_type first = m_Reserved.fetch_add(count, std::memory_order_relaxed);
+        if (count == 0)
+        {
+            return iterator(this, first);
+        }
+        size_type i = first;
+        try
+        {
+            ensure_segments(first, first + count);
+            for (; i < first + count; ++i)
+            {
+                construct(slot(i));
+            }
+        }
+        catch (...)
+        {
+            while (i > first)
+            {
+                alloc_traits::destroy(m_Allocator, slot(--i));
+            }
+            abandon(first, first + count);
+            throw;
+        }
+        publish(first, first + count, slot_ready);
+        return iterator(this, first);
+    }
+
+    /// Gives back the unconstructed indices [first, last) when they are still the last ones
+    /// reserved, otherwise marks them dead so publication does not stall on them
+    void abandon(size_type first, size_type last)
+    {
+        size_type expected = last;
+        if (!m_Reserved.compare_exchange_strong(expected, first))
+        {
+            ensure_segments(first, last);
+            publish(first, last, slot_dead);
+        }
+    }
+
+    bool is_dead(size_type position) const noexcept
+    {
+        flag_type* state = slot_state(position);
+        return state != nullptr && state->load() == slot_dead;
+    }
+
+    /// First index from position on that is not a dead slot, or size()
+    size_type skip_dead(size_type position) const noexcept
+    {
+        size_type published = size();
+        while (position < published && is_dead(position))
+        {
+            ++position;
+        }
+        return position;
+    }
+
+    /// True when there is no element between the two indices, only dead slots
+    bool only_dead_between(size_type first, size_type last) const noexcept
+    {
+        for (; first < last; ++first)
+        {
+            if (!is_dead(first))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Marks [first, last) ready or dead, then moves the published prefix over every slot
+    /// that is no longer empty. States use seq_cst so that of two neighbours finishing at once,
+    /// at least one sees the other's state and carries the prefix past both.
+    void publish(size_type first, size_type last, unsigned char state)
+    {
+        for (size_type i = first; i < last; ++i)
+        {
+            slot_state(i)->store(state);
+        }
+        size_type published = m_Published.load();
+        while (published < m_Reserved.load())
+        {
+            flag_type* next = slot_state(published);
+            if (next == nullptr || next->load() == slot_empty)
+            {
+                break;
+            }
+            if (m_Published.compare_exchange_weak(published, published + 1))
+            {
+                ++published;
+            }
+        }
+    }
+
+public:
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag; /// stepping skips dead slots
+        using value_type = TType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<Const, const TType*, TType*>::type;
+        using reference = typename std::conditional<Const, const TType&, TType&>::type;
+        using container_pointer = typename std::conditional<Const, const concurrent_vector*, concurrent_vector*>::type;
+
+    private:
+        container_pointer m_Container = nullptr;
+        size_type m_Index = 0;
+
+    public:
+        Iterator() = default;
+        Iterator(container_pointer container, size_type index) : m_Container(container), m_Index(index) {}
+
+        template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+        Iterator(const Iterator<OtherConst>& other) : m_Container(other.container()), m_Index(other.index()) {}
+
+        container_pointer container() const { return m_Container; }
+        size_type index() const { return m_Index; }
+
+        reference operator*() const { return (*m_Container)[m_Index]; }
+        pointer operator->() const { return &(*m_Container)[m_Index]; }
+        reference operator[](difference_type offset) const { return (*m_Container)[m_Index + offset]; }
+
+        Iterator& operator++() { m_Index = m_Container->skip_dead(m_Index + 1); return *this; }
+        Iterator& operator--()
+        {
+            do
+            {
+                --m_Index;
+            } while (m_Index != 0 && m_Container->is_dead(m_Index));
+            return *this;
+        }
+        Iterator operator++(int) { Iterator temp(*this); ++*this; return temp; }
+        Iterator operator--(int) { Iterator temp(*this); --*this; return temp; }
+        Iterator& operator+=(difference_type offset) { m_Index += offset; return *this; }
+        Iterator& operator-=(difference_type offset) { m_Index -= offset; return *this; }
+
+        friend Iterator operator+(Iterator it, difference_type offset) { return it += offset; }
+        friend Iterator operator+(difference_type offset, Iterator it) { return it += offset; }
+        friend Iterator operator-(Iterator it, difference_type offset) { return it -= offset; }
+
+        friend difference_type operator-(const Iterator& lhs, const Iterator& rhs)
+        {
+            return static_cast<difference_type>(lhs.m_Index) - static_cast<difference_type>(rhs.m_Index);
+        }
+
+        /// Positions with only dead slots between them are equal, so an end() taken before a
+        /// slot there died still stops a loop that stepped over it
+        bool equals(const Iterator& other) const
+        {
+            return m_Container == other.m_Container
+                   && (m_Index == other.m_Index
+                       || m_Container->only_dead_between(std::min(m_Index, other.m_Index), std::max(m_Index, other.m_Index)));
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) { return lhs.equals(rhs); }
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return !(lhs == rhs); }
+        friend bool operator<(const Iterator& lhs, const Iterator& rhs) { return lhs.m_Index < rhs.m_Index; }
+        friend bool operator>(const Iterator& lhs, const Iterator& rhs) { return rhs < lhs; }
+        friend bool operator<=(const Iterator& lhs, const Iterator& rhs) { return !(rhs < lhs); }
+        friend bool operator>=(const Iterator& lhs, const Iterator& rhs) { return !(lhs < rhs); }
+    };
+};
+
+template <typename TType, typename TAlloc>
+void swap(concurrent_vector<TType, TAlloc>& lhs, concurrent_vector<TType, TAlloc>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+}
@@ -0,0 +1,370 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ft
+{
+
+namespace detail
+{
+
+/// Node of the index-linked stacks: the index of the node below and raw room for one value
+template <typename TType>
+struct lifo_node
+{
+    std::atomic<std::uint32_t> next;
+    typename std::aligned_storage<sizeof(TType), alignof(TType)>::type storage;
+
+    lifo_node() noexcept : next(std::numeric_limits<std::uint32_t>::max()) {}
+
+    TType* value() noexcept { return reinterpret_cast<TType*>(&storage); }
+};
+
+/// Top of a LIFO chain of node indices. The index sits in the low half of one 64-bit word
+/// and a tag bumped by every successful CAS in the high half, so a top that was popped and
+/// pushed back in between never compares equal (ABA). Nodes are never freed while linked
+/// or reusable, so reading a stale node's next is harmless: the CAS then fails.
+class tagged_top
+{
+public:
+    static constexpr std::uint32_t null_index = std::numeric_limits<std::uint32_t>::max();
+
+private:
+    std::atomic<std::uint64_t> m_Word;
+
+    static std::uint64_t pack(std::uint32_t index, std::uint32_t tag) noexcept { return std::uint64_t(tag) << 32 | index; }
+    static std::uint32_t index_of(std::uint64_t word) noexcept { return static_cast<std::uint32_t>(word); }
+    static std::uint32_t tag_of(std::uint64_t word) noexcept { return static_cast<std::uint32_t>(word >> 32); }
+
+public:
+    tagged_top() noexcept : m_Word(pack(null_index, 0)) {}
+
+    bool empty() const noexcept
+    {
+        return index_of(m_Word.load(std::memory_order_acquire)) == null_index;
+    }
+
+    /// Puts the chain first..last, already linked through next, on top
+    template <typename TNodes>
+    void push(TNodes& nodes, std::uint32_t first, std::uint32_t last) noexcept
+    {
+        std::uint64_t old = m_Word.load(std::memory_order_relaxed);
+        do
+        {
+            nodes.node(last).next.store(index_of(old), std::memory_order_relaxed);
+        }
+        while (!m_Word.compare_exchange_weak(old, pack(first, tag_of(old) + 1), std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /// Unlinks up to max_count nodes from the top with one CAS and returns the first of them,
+    /// or null_index; they stay linked through next, count receives how many there are
+    template <typename TNodes>
+    std::uint32_t pop(TNodes& nodes, std::size_t max_count, std::size_t& count) noexcept
+    {
+        std::uint64_t old = m_Word.load(std::memory_order_acquire);
+        for (;;)
+        {
+            std::uint32_t first = index_of(old);
+            if (first == null_index || max_count == 0)
+            {
+                count = 0;
+                return null_index;
+            }
+            std::size_t taken = 1;
+            std::uint32_t rest = nodes.node(first).next.load(std::memory_order_relaxed);
+            for (std::uint32_t last = first; taken < max_count && rest != null_index; ++taken)
+            {
+                last = rest;
+                rest = nodes.node(last).next.load(std::memory_order_relaxed);
+            }
+            if (m_Word.compare_exchange_weak(old, pack(rest, tag_of(old) + 1), std::memory_order_acquire, std::memory_order_acquire))
+            {
+                count = taken;
+                return first;
+            }
+        }
+    }
+};
+
+/// Value handling shared by the stacks; TDerived provides node(index) and acquire_node()
+template <typename TDerived, typename TType>
+class index_lifo
+{
+protected:
+    tagged_top m_Top;
+    tagged_top m_Free;
+
+    index_lifo() = default;
+    index_lifo(const index_lifo&) = delete;
+    index_lifo& operator=(const index_lifo&) = delete;
+
+    TDerived& derived() noexcept { return static_cast<TDerived&>(*this); }
+
+    template <typename... Args>
+    void emplace_at(std::uint32_t index, Args&&... args)
+    {
+        try
+        {
+            ::new (static_cast<void*>(derived().node(index).value())) TType(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            m_Free.push(derived(), index, index);
+            throw;
+        }
+        m_Top.push(derived(), index, index);
+    }
+
+    void destroy_all() noexcept /// not concurrent, for destructors
+    {
+        std::size_t count = 0;
+        std::uint32_t index = m_Top.pop(derived(), std::numeric_limits<std::size_t>::max(), count);
+        for (; count > 0; --count)
+        {
+            derived().node(index).value()->~TType();
+            index = derived().node(index).next.load(std::memory_order_relaxed);
+        }
+    }
+
+public:
+    using value_type = TType;
+    using size_type = std::size_t;
+
+    bool empty() const noexcept
+    {
+        return m_Top.empty();
+    }
+
+    bool try_pop(value_type& out)
+    {
+        return try_pop_bulk(&out, 1) == 1;
+    }
+
+    /// Pops up to max_count values with a single CAS, writing them to out top first
+    template <typename TOutputIterator>
+    size_type try_pop_bulk(TOutputIterator out, size_type max_count)
+    {
+        size_type count = 0;
+        std::uint32_t first = m_Top.pop(derived(), max_count, count);
+        std::uint32_t index = first;
+        std::uint32_t last = first;
+        for (size_type i = 0; i < count; ++i)
+        {
+            value_type* value = derived().node(index).value();
+            *out = std::move(*value);
+            ++out;
+            value->~value_type();
+            last = index;
+            index = derived().node(index).next.load(std::memory_order_relaxed);
+        }
+        if (count != 0)
+        {
+            m_Free.push(derived(), first, last);
+        }
+        return count;
+    }
+};
+
+}
+
+/// Unbounded lock-free LIFO (Treiber stack) for any number of pushing and popping threads.
+///
+/// Nodes live in power-of-two segments addressed by a 32-bit index and are recycled through
+/// a second lock-free free list instead of being freed, which is what makes the tagged-index
+/// CAS safe without hazard pointers. Memory therefore stays at the high-water mark until the
+/// stack is destroyed. Destruction is not concurrent.
+template <typename TType, typename TAllocator = std::allocator<TType>>
+class lockfree_stack : public detail::index_lifo<lockfree_stack<TType, TAllocator>, TType>
+{
+    using base = detail::index_lifo<lockfree_stack, TType>;
+    friend base;
+    friend class detail::tagged_top;
+
+public:
+    using value_type = TType;
+    using allocator_type = TAllocator;
+    using size_type = std::size_t;
+
+private:
+    using node_type = detail::lifo_node<TType>;
+    using node_allocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<node_type>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    static constexpr size_type first_segment_bits = 5;
+    static constexpr size_type first_segment_size = size_type(1) << first_segment_bits;
+    static constexpr size_type max_segments = 32 - first_segment_bits; /// keeps every index below null_index
+
+    node_allocator m_Allocator;
+    std::atomic<node_type*> m_Segments[max_segments];
+    std::atomic<size_type> m_Fresh;
+
+public:
+    explicit lockfree_stack(const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_Fresh(0)
+    {
+        for (size_type k = 0; k < max_segments; ++k)
+        {
+            m_Segments[k].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~lockfree_stack()
+    {
+        this->destroy_all();
+        for (size_type k = 0; k < max_segments; ++k)
+        {
+            node_type* nodes = m_Segments[k].load();
+            if (nodes != nullptr)
+            {
+                node_traits::deallocate(m_Allocator, nodes, segment_size(k));
+            }
+        }
+    }
+
+    void push(const value_type& val) { emplace(val); }
+    void push(value_type&& val) { emplace(std::move(val)); }
+
+    template <typename... Args>
+    void emplace(Args&&... args)
+    {
+        this->emplace_at(acquire_node(), std::forward<Args>(args)...);
+    }
+
+private:
+    static size_type segment_of(size_type index) noexcept
+    {
+        size_type shifted = index + first_segment_size;
+        return std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll(shifted) - first_segment_bits;
+    }
+
+    static size_type segment_base(size_type k) noexcept { return (first_segment_size << k) - first_segment_size; }
+    static size_type segment_size(size_type k) noexcept { return first_segment_size << k; }
+
+    node_type& node(std::uint32_t index) noexcept
+    {
+        size_type k = segment_of(index);
+        return m_Segments[k].load(std::memory_order_acquire)[index - segment_base(k)];
+    }
+
+    std::uint32_t acquire_node()
+    {
+        size_type count = 0;
+        std::uint32_t index = this->m_Free.pop(*this, 1, count);
+        if (index != detail::tagged_top::null_index)
+        {
+            return index;
+        }
+        size_type fresh = m_Fresh.fetch_add(1, std::memory_order_relaxed);
+        if (fresh >= segment_base(max_segments))
+        {
+            throw std::length_error("lockfree_stack: too many elements");
+        }
+        size_type k = segment_of(fresh);
+        if (m_Segments[k].load(std::memory_order_acquire) == nullptr)
+        {
+            install_segment(k);
+        }
+        return static_cast<std::uint32_t>(fresh);
+    }
+
+    void install_segment(size_type k) /// whoever needs the segment first allocates it, a losing CAS frees its copy
+    {
+        node_type* nodes = node_traits::allocate(m_Allocator, segment_size(k));
+        for (size_type i = 0; i < segment_size(k); ++i)
+        {
+            ::new (static_cast<void*>(nodes + i)) node_type();
+        }
+        node_type* expected = nullptr;
+        if (!m_Segments[k].compare_exchange_strong(expected, nodes, std::memory_order_acq_rel))
+        {
+            node_traits::deallocate(m_Allocator, nodes, segment_size(k));
+        }
+    }
+};
+
+/// Fixed-capacity lock-free LIFO for any number of threads: the same tagged-index stack over
+/// one preallocated node array, never allocating after construction. try_push fails when full.
+template <typename TType, typename TAllocator = std::allocator<TType>>
+class bounded_stack : public detail::index_lifo<bounded_stack<TType, TAllocator>, TType>
+{
+    using base = detail::index_lifo<bounded_stack, TType>;
+    friend base;
+    friend class detail::tagged_top;
+
+public:
+    using value_type = TType;
+    using allocator_type = TAllocator;
+    using size_type = std::size_t;
+
+private:
+    using node_type = detail::lifo_node<TType>;
+    using node_allocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<node_type>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    node_allocator m_Allocator;
+    size_type m_Capacity;
+    node_type* m_Nodes;
+
+public:
+    explicit bounded_stack(size_type capacity, const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_Capacity(capacity)
+        , m_Nodes(nullptr)
+    {
+        if (capacity >= detail::tagged_top::null_index)
+        {
+            throw std::length_error("bounded_stack: capacity is too much");
+        }
+        if (capacity == 0)
+        {
+            return;
+        }
+        m_Nodes = node_traits::allocate(m_Allocator, capacity);
+        for (size_type i = 0; i < capacity; ++i)
+        {
+            ::new (static_cast<void*>(m_Nodes + i)) node_type();
+            m_Nodes[i].next.store(static_cast<std::uint32_t>(i + 1), std::memory_order_relaxed);
+        }
+        this->m_Free.push(*this, 0, static_cast<std::uint32_t>(capacity - 1));
+    }
+
+    ~bounded_stack()
+    {
+        this->destroy_all();
+        if (m_Nodes != nullptr)
+        {
+            node_traits::deallocate(m_Allocator, m_Nodes, m_Capacity);
+        }
+    }
+
+    size_type capacity() const noexcept { return m_Capacity; }
+
+    bool try_push(const value_type& val) { return try_emplace(val); }
+    bool try_push(value_type&& val) { return try_emplace(std::move(val)); }
+
+    template <typename... Args>
+    bool try_emplace(Args&&... args)
+    {
+        size_type count = 0;
+        std::uint32_t index = this->m_Free.pop(*this, 1, count);
+        if (index == detail::tagged_top::null_index)
+        {
+            return false;
+        }
+        this->emplace_at(index, std::forward<Args>(args)...);
+        return true;
+    }
+
+private:
+    node_type& node(std::uint32_t index) noexcept { return m_Nodes[index]; }
+};
+
+}
@@ -0,0 +1,560 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ft
+{
+
+namespace detail
+{
+
+template <std::size_t... Index>
+struct soa_indices
+{};
+
+template <std::size_t Count, std::size_t... Index>
+struct make_soa_indices : make_soa_indices<Count - 1, Count - 1, Index...>
+{};
+
+template <std::size_t... Index>
+struct make_soa_indices<0, Index...>
+{
+    using type = soa_indices<Index...>;
+};
+
+}
+
+/// Contiguous view of one column
+template <typename TType>
+class column_span
+{
+    TType* m_Data;
+    std::size_t m_Size;
+
+public:
+    using value_type = typename std::remove_const<TType>::type;
+    using iterator = TType*;
+
+    column_span(TType* data, std::size_t size) : m_Data(data), m_Size(size) {}
+
+    TType* data() const noexcept { return m_Data; }
+    std::size_t size() const noexcept { return m_Size; }
+    bool empty() const noexcept { return m_Size == 0; }
+    iterator begin() const noexcept { return m_Data; }
+    iterator end() const noexcept { return m_Data + m_Size; }
+    TType& operator[](std::size_t position) const noexcept { return m_Data[position]; }
+};
+
+/// Two-column rows also read like a pair: row.first, row.second
+template <typename... TRefs>
+struct soa_pair_members
+{
+    explicit soa_pair_members(TRefs...) {}
+};
+
+template <typename TFirst, typename TSecond>
+struct soa_pair_members<TFirst, TSecond>
+{
+    TFirst first;
+    TSecond second;
+
+    soa_pair_members(TFirst first_ref, TSecond second_ref) : first(first_ref), second(second_ref) {}
+};
+
+/// Row proxy of a soa_vector: one reference per column
+template <typename... TRefs>
+class soa_reference : public soa_pair_members<TRefs...>
+{
+    std::tuple<TRefs...> m_Refs;
+
+public:
+    explicit soa_reference(TRefs... refs) : soa_pair_members<TRefs...>(refs...), m_Refs(refs...) {}
+
+    soa_reference(const soa_reference&) = default;
+
+    template <std::size_t Index>
+    typename std::tuple_element<Index, std::tuple<TRefs...>>::type get() const noexcept
+    {
+        return std::get<Index>(m_Refs);
+    }
+
+    template <typename... TValues>
+    operator std::tuple<TValues...>() const { return std::tuple<TValues...>(m_Refs); }
+
+    template <typename TFirst, typename TSecond>
+    operator std::pair<TFirst, TSecond>() const { return std::pair<TFirst, TSecond>(std::get<0>(m_Refs), std::get<1>(m_Refs)); }
+
+    soa_reference& operator=(const soa_reference& other) /// assigns the row values, not the references
+    {
+        m_Refs = other.m_Refs;
+        return *this;
+    }
+
+    template <typename TRow>
+    soa_reference& operator=(const TRow& row) /// from a tuple or pair of values
+    {
+        m_Refs = row;
+        return *this;
+    }
+};
+
+/// Sequence of rows (Ts...) stored column by column, each column one contiguous array.
+/// Scans over a single column stream through memory; push_back and erase touch every column.
+/// Relocation moves elements and assumes those moves do not throw.
+template <typename... Ts>
+class soa_vector
+{
+    static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one column");
+
+public:
+    using value_type = std::tuple<Ts...>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = soa_reference<Ts&...>;
+    using const_reference = soa_reference<const Ts&...>;
+
+    template <bool Const>
+    class Iterator;
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    template <std::size_t Index>
+    using column_type = typename std::tuple_element<Index, value_type>::type;
+
+private:
+    using indices = typename detail::make_soa_indices<sizeof...(Ts)>::type;
+
+    std::tuple<Ts*...> m_Columns;
+    size_type m_Size = 0;
+    size_type m_Capacity = 0;
+
+public:
+    soa_vector() : m_Columns(static_cast<Ts*>(nullptr)...) {}
+
+    soa_vector(const soa_vector& other) : soa_vector()
+    {
+        reserve(other.m_Size);
+        for (size_type i = 0; i < other.m_Size; ++i)
+        {
+            copy_row_from(other, i, indices());
+        }
+    }
+
+    soa_vector(soa_vector&& other) noexcept
+        : m_Columns(other.m_Columns)
+        , m_Size(other.m_Size)
+        , m_Capacity(other.m_Capacity)
+    {
+        other.m_Columns = std::tuple<Ts*...>(static_cast<Ts*>(nullptr)...);
+        other.m_Size = 0;
+        other.m_Capacity = 0;
+    }
+
+    soa_vector& operator=(soa_vector other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~soa_vector()
+    {
+        clear();
+        free_columns(m_Columns, m_Capacity, indices());
+    }
+
+    // iterator methods
+    iterator begin() noexcept { return iterator(this, 0); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, m_Size); }
+    const_iterator end() const noexcept { return const_iterator(this, m_Size); }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // capacity methods
+    size_type size() const noexcept { return m_Size; }
+    size_type capacity() const noexcept { return m_Capacity; }
+    bool empty() const noexcept { return m_Size == 0; }
+
+    size_type max_size() const noexcept
+    {
+        return std::numeric_limits<size_type>::max() / sum_of_sizes();
+    }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity > max_size())
+        {
+            throw std::length_error("reserve of soa_vector: new capacity is too much");
+        }
+        if (new_capacity > m_Capacity)
+        {
+            reallocate(new_capacity, indices());
+        }
+    }
+
+    void resize(size_type new_size)
+    {
+        if (new_size > m_Capacity)
+        {
+            reserve(recommend(new_size));
+        }
+        while (m_Size < new_size)
+        {
+            construct_row<0>(m_Columns, m_Size, Ts()...);
+            ++m_Size;
+        }
+        if (new_size < m_Size)
+        {
+            destroy_rows(new_size, m_Size);
+        }
+    }
+
+    // element access methods
+    reference operator[](size_type position) noexcept { return row<reference>(position, indices()); }
+    const_reference operator[](size_type position) const noexcept { return row<const_reference>(position, indices()); }
+
+    reference at(size_type position)
+    {
+        if (position >= m_Size)
+        {
+            throw std::out_of_range("out of range of soa_vector");
+        }
+        return (*this)[position];
+    }
+
+    const_reference at(size_type position) const
+    {
+        if (position >= m_Size)
+        {
+            throw std::out_of_range("out of range of soa_vector");
+        }
+        return (*this)[position];
+    }
+
+    reference front() noexcept { return (*this)[0]; }
+    const_reference front() const noexcept { return (*this)[0]; }
+    reference back() noexcept { return (*this)[m_Size - 1]; }
+    const_reference back() const noexcept { return (*this)[m_Size - 1]; }
+
+    template <std::size_t Index>
+    column_span<column_type<Index>> column() noexcept
+    {
+        return column_span<column_type<Index>>(std::get<Index>(m_Columns), m_Size);
+    }
+
+    template <std::size_t Index>
+    column_span<const column_type<Index>> column() const noexcept
+    {
+        return column_span<const column_type<Index>>(std::get<Index>(m_Columns), m_Size);
+    }
+
+    template <std::size_t Index>
+    column_type<Index>* data() noexcept { return std::get<Index>(m_Columns); }
+
+    template <std::size_t Index>
+    const column_type<Index>* data() const noexcept { return std::get<Index>(m_Columns); }
+
+    // modifiers methods
+    template <typename... TArgs, typename = typename std::enable_if<sizeof...(TArgs) == sizeof...(Ts)>::type>
+    void push_back(TArgs&&... values) /// one value per column
+    {
+        if (m_Size == m_Capacity)
+        {
+            grow_with_row(recommend(m_Size + 1), indices(), std::forward<TArgs>(values)...); /// values may be our own elements
+        }
+        else
+        {
+            construct_row<0>(m_Columns, m_Size, std::forward<TArgs>(values)...);
+        }
+        ++m_Size;
+    }
+
+    void push_back(const value_type& row)
+    {
+        push_tuple(row, indices());
+    }
+
+    void pop_back()
+    {
+        destroy_rows(m_Size - 1, m_Size);
+    }
+
+    iterator erase(const_iterator position)
+    {
+        return erase(position, position + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        size_type start_idx = first.index();
+        size_type end_idx = last.index();
+        if (start_idx != end_idx)
+        {
+            shift_columns(start_idx, end_idx, indices());
+            destroy_rows(m_Size - (end_idx - start_idx), m_Size);
+        }
+        return iterator(this, start_idx);
+    }
+
+    void swap(soa_vector& other) noexcept
+    {
+        std::swap(m_Columns, other.m_Columns);
+        std::swap(m_Size, other.m_Size);
+        std::swap(m_Capacity, other.m_Capacity);
+    }
+
+    void clear() noexcept
+    {
+        destroy_rows(0, m_Size);
+    }
+
+private:
+    template <typename TType>
+    static TType* allocate(size_type count)
+    {
+        return count == 0 ? nullptr : std::allocator<TType>().allocate(count);
+    }
+
+    template <typename TType>
+    static void deallocate(TType* column, size_type count)
+    {
+        if (column != nullptr)
+        {
+            std::allocator<TType>().deallocate(column, count);
+        }
+    }
+
+    static size_type sum_of_sizes()
+    {
+        const size_type sizes[] = {sizeof(Ts)...};
+        size_type total = 0;
+        for (size_type size : sizes)
+        {
+            total += size;
+        }
+        return total;
+    }
+
+    size_type recommend(size_type new_size) const
+    {
+        size_type grown = m_Capacity * 2;
+        return grown < new_size ? new_size : std::min(grown, max_size());
+    }
+
+    template <typename TRow, std::size_t... Index>
+    TRow row(size_type position, detail::soa_indices<Index...>) const noexcept
+    {
+        return TRow(std::get<Index>(m_Columns)[position]...);
+    }
+
+    /// Builds column Index onward of row position, unwinding the columns already built on throw
+    template <std::size_t Index, typename TArg, typename... TRest>
+    static void construct_row(std::tuple<Ts*...>& columns, size_type position, TArg&& arg, TRest&&... rest)
+    {
+        using column = column_type<Index>;
+        column* slot = std::get<Index>(columns) + position;
+        ::new (static_cast<void*>(slot)) column(std::forward<TArg>(arg));
+        try
+        {
+            construct_row<Index + 1>(columns, position, std::forward<TRest>(rest)...);
+        }
+        catch (...)
+        {
+            slot->~column();
+            throw;
+        }
+    }
+
+    template <std::size_t Index>
+    static void construct_row(std::tuple<Ts*...>&, size_type)
+    {}
+
+    template <std::size_t... Index>
+    void push_tuple(const value_type& row, detail::soa_indices<Index...>)
+    {
+        push_back(std::get<Index>(row)...);
+    }
+
+    template <std::size_t... Index>
+    void copy_row_from(const soa_vector& other, size_type position, detail::soa_indices<Index...>)
+    {
+        push_back(std::get<Index>(other.m_Columns)[position]...);
+    }
+
+    void destroy_rows(size_type first, size_type last) noexcept
+    {
+        destroy_columns(first, last, indices());
+        m_Size = first;
+    }
+
+    template <std::size_t... Index>
+    void destroy_columns(size_type first, size_type last, detail::soa_indices<Index...>) noexcept
+    {
+        int expand[] = {0, (destroy_column(std::get<Index>(m_Columns), first, last), 0)...};
+        (void)expand;
+    }
+
+    template <typename TType>
+    static void destroy_column(TType* column, size_type first, size_type last) noexcept
+    {
+        for (size_type i = first; i < last; ++i)
+        {
+            column[i].~TType();
+        }
+    }
+
+    /// Moves rows [end_idx, size) down to start_idx in every column
+    template <std::size_t... Index>
+    void shift_columns(size_type start_idx, size_type end_idx, detail::soa_indices<Index...>)
+    {
+        int expand[] = {0, (std::move(std::get<Index>(m_Columns) + end_idx, std::get<Index>(m_Columns) + m_Size,
+                                      std::get<Index>(m_Columns) + start_idx), 0)...};
+        (void)expand;
+    }
+
+    template <std::size_t... Index>
+    static std::tuple<Ts*...> allocate_columns(size_type capacity, detail::soa_indices<Index...>)
+    {
+        std::tuple<Ts*...> fresh(static_cast<Ts*>(nullptr)...);
+        try
+        {
+            int expand[] = {0, (std::get<Index>(fresh) = allocate<Ts>(capacity), 0)...};
+            (void)expand;
+        }
+        catch (...)
+        {
+            free_columns(fresh, capacity, indices());
+            throw;
+        }
+        return fresh;
+    }
+
+    template <std::size_t... Index>
+    static void free_columns(std::tuple<Ts*...>& columns, size_type capacity, detail::soa_indices<Index...>) noexcept
+    {
+        int expand[] = {0, (deallocate(std::get<Index>(columns), capacity), 0)...};
+        (void)expand;
+    }
+
+    template <std::size_t... Index>
+    void adopt_columns(std::tuple<Ts*...>& fresh, size_type new_capacity, detail::soa_indices<Index...>)
+    {
+        int expand[] = {0, (relocate(std::get<Index>(fresh), std::get<Index>(m_Columns)), 0)...};
+        (void)expand;
+        m_Columns = fresh;
+        m_Capacity = new_capacity;
+    }
+
+    template <std::size_t... Index>
+    void reallocate(size_type new_capacity, detail::soa_indices<Index...>)
+    {
+        std::tuple<Ts*...> fresh = allocate_columns(new_capacity, indices());
+        adopt_columns(fresh, new_capacity, indices());
+    }
+
+    /// Builds the new last row in fresh storage before the old rows move, as values may refer to them
+    template <std::size_t... Index, typename... TArgs>
+    void grow_with_row(size_type new_capacity, detail::soa_indices<Index...>, TArgs&&... values)
+    {
+        std::tuple<Ts*...> fresh = allocate_columns(new_capacity, indices());
+        try
+        {
+            construct_row<0>(fresh, m_Size, std::forward<TArgs>(values)...);
+        }
+        catch (...)
+        {
+            free_columns(fresh, new_capacity, indices());
+            throw;
+        }
+        adopt_columns(fresh, new_capacity, indices());
+    }
+
+    template <typename TType>
+    void relocate(TType* destination, TType* source)
+    {
+        for (size_type i = 0; i < m_Size; ++i)
+        {
+            ::new (static_cast<void*>(destination + i)) TType(std::move_if_noexcept(source[i]));
+            source[i].~TType();
+        }
+        deallocate(source, m_Capacity);
+    }
+
+public:
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename soa_vector::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = typename std::conditional<Const, typename soa_vector::const_reference, typename soa_vector::reference>::type;
+        using pointer = void;
+        using container_pointer = typename std::conditional<Const, const soa_vector*, soa_vector*>::type;
+
+    private:
+        container_pointer m_Container = nullptr;
+        size_type m_Index = 0;
+
+    public:
+        Iterator() = default;
+        Iterator(container_pointer container, size_type index) : m_Container(container), m_Index(index) {}
+
+        template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+        Iterator(const Iterator<OtherConst>& other) : m_Container(other.container()), m_Index(other.index()) {}
+
+        container_pointer container() const { return m_Container; }
+        size_type index() const { return m_Index; }
+
+        reference operator*() const { return (*m_Container)[m_Index]; }
+        reference operator[](difference_type offset) const { return (*m_Container)[m_Index + offset]; }
+
+        Iterator& operator++() { ++m_Index; return *this; }
+        Iterator& operator--() { --m_Index; return *this; }
+        Iterator operator++(int) { Iterator temp(*this); ++m_Index; return temp; }
+        Iterator operator--(int) { Iterator temp(*this); --m_Index; return temp; }
+        Iterator& operator+=(difference_type offset) { m_Index += offset; return *this; }
+        Iterator& operator-=(difference_type offset) { m_Index -= offset; return *this; }
+
+        friend Iterator operator+(Iterator it, difference_type offset) { return it += offset; }
+        friend Iterator operator+(difference_type offset, Iterator it) { return it += offset; }
+        friend Iterator operator-(Iterator it, difference_type offset) { return it -= offset; }
+
+        friend difference_type operator-(const Iterator& lhs, const Iterator& rhs)
+        {
+            return static_cast<difference_type>(lhs.m_Index) - static_cast<difference_type>(rhs.m_Index);
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) { return lhs.m_Index == rhs.m_Index && lhs.m_Container == rhs.m_Container; }
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return !(lhs == rhs); }
+        friend bool operator<(const Iterator& lhs, const Iterator& rhs) { return lhs.m_Index < rhs.m_Index; }
+        friend bool operator>(const Iterator& lhs, const Iterator& rhs) { return rhs < lhs; }
+        friend bool operator<=(const Iterator& lhs, const Iterator& rhs) { return !(rhs < lhs); }
+        friend bool operator>=(const Iterator& lhs, const Iterator& rhs) { return !(lhs < rhs); }
+    };
+};
+
+template <typename... Ts>
+void swap(soa_vector<Ts...>& lhs, soa_vector<Ts...>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+}
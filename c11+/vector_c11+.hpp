@@ -1,5 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
 namespace ft
 {
 
@@ -15,10 +24,742 @@ public:
     using const_reference = const value_type&;
     using pointer = typename std::allocator_traits<TAllocator>::pointer;
     using const_pointer = typename std::allocator_traits<TAllocator>::const_pointer;
-//    using iterator = ;
-//    using const_iterator = ;
-//    using reverse_iterator = ;
-//    using const_reverse_iterator = ;
+    using iterator = pointer; /// raw pointers already are random access iterators for std algorithms
+    using const_iterator = const_pointer;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static_assert(std::is_same<value_type, typename allocator_type::value_type>::value,
+                  "Different type into vector and vector allocator");
+
+private:
+    using alloc_traits = std::allocator_traits<allocator_type>;
+
+    allocator_type m_Allocator;
+    size_type m_Size = 0;
+    size_type m_Capacity = 0;
+    pointer m_Data = nullptr;
+
+public:
+    vector() noexcept(noexcept(allocator_type())) = default;
+
+    explicit vector(const allocator_type& alloc) noexcept
+        : m_Allocator(alloc)
+    {}
+
+    explicit vector(size_type count, const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+    {
+        resize(count);
+    }
+
+    vector(size_type count, const value_type& value, const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+    {
+        assign(count, value);
+    }
+
+    template <typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+    vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+    {
+        assign(first, last);
+    }
+
+    vector(std::initializer_list<value_type> init, const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    vector(const vector& other)
+        : vector(other, alloc_traits::select_on_container_copy_construction(other.m_Allocator))
+    {}
+
+    vector(const vector& other, const allocator_type& alloc)
+        : m_Allocator(alloc)
+    {
+        assign(other.begin(), other.end());
+    }
+
+    vector(vector&& other) noexcept
+        : m_Allocator(std::move(other.m_Allocator))
+    {
+        steal(other);
+    }
+
+    vector(vector&& other, const allocator_type& alloc)
+        : m_Allocator(alloc)
+    {
+        if (m_Allocator == other.m_Allocator)
+        {
+            steal(other);
+        }
+        else
+        {
+            reserve(other.size());
+            m_Size = construct_range(m_Data, std::make_move_iterator(other.begin()), std::make_move_iterator(other.end())) - m_Data;
+        }
+    }
+
+    ~vector()
+    {
+        release();
+    }
+
+    vector& operator=(const vector& other)
+    {
+        if (&other != this)
+        {
+            if (alloc_traits::propagate_on_container_copy_assignment::value && m_Allocator != other.m_Allocator)
+            {
+                release();
+            }
+            if (alloc_traits::propagate_on_container_copy_assignment::value)
+            {
+                m_Allocator = other.m_Allocator;
+            }
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    vector& operator=(vector&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value)
+    {
+        if (&other == this)
+        {
+            return *this;
+        }
+        if (alloc_traits::propagate_on_container_move_assignment::value)
+        {
+            release();
+            m_Allocator = std::move(other.m_Allocator);
+            steal(other);
+        }
+        else if (m_Allocator == other.m_Allocator)
+        {
+            release();
+            steal(other);
+        }
+        else
+        {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        }
+        return *this;
+    }
+
+    vector& operator=(std::initializer_list<value_type> init)
+    {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+    void assign(size_type count, const value_type& value)
+    {
+        if (count > capacity())
+        {
+            vector tmp(m_Allocator);
+            tmp.reserve(count);
+            tmp.m_Size = tmp.construct_fill(tmp.m_Data, count, value) - tmp.m_Data;
+            swap(tmp);
+        }
+        else if (count > size())
+        {
+            std::fill(begin(), end(), value);
+            m_Size = construct_fill(end(), count - size(), value) - m_Data;
+        }
+        else
+        {
+            std::fill_n(begin(), count, value);
+            destroy_tail(m_Data + count);
+        }
+    }
+
+    template <typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+    void assign(InputIterator first, InputIterator last)
+    {
+        assign_range(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+    }
+
+    void assign(std::initializer_list<value_type> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    allocator_type get_allocator() const { return m_Allocator; }
+
+    // element access methods
+    reference operator[](size_type position) { return m_Data[position]; }
+    const_reference operator[](size_type position) const { return m_Data[position]; }
+
+    reference at(size_type position)
+    {
+        if (position >= size())
+        {
+            throw std::out_of_range("out of range of vector");
+        }
+        return m_Data[position];
+    }
+
+    const_reference at(size_type position) const
+    {
+        if (position >= size())
+        {
+            throw std::out_of_range("out of range of vector");
+        }
+        return m_Data[position];
+    }
+
+    reference front() { return *begin(); }
+    const_reference front() const { return *begin(); }
+    reference back() { return *(end() - 1); }
+    const_reference back() const { return *(end() - 1); }
+
+    value_type* data() noexcept { return m_Data; }
+    const value_type* data() const noexcept { return m_Data; }
+
+    // iterator methods
+    iterator begin() noexcept { return m_Data; }
+    const_iterator begin() const noexcept { return m_Data; }
+    iterator end() noexcept { return m_Data + m_Size; }
+    const_iterator end() const noexcept { return m_Data + m_Size; }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    // capacity methods
+    bool empty() const noexcept { return m_Size == 0; }
+    size_type size() const noexcept { return m_Size; }
+    size_type max_size() const noexcept { return alloc_traits::max_size(m_Allocator); }
+    size_type capacity() const noexcept { return m_Capacity; }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity > max_size())
+        {
+            throw std::length_error("reserve of vector: new capacity is too much");
+        }
+        if (new_capacity > capacity())
+        {
+            pointer new_data = alloc_traits::allocate(m_Allocator, new_capacity);
+            relocate_or_free(new_data, new_capacity, m_Data, end());
+            replace_storage(new_data, new_capacity);
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        if (capacity() > size())
+        {
+            pointer new_data = size() ? alloc_traits::allocate(m_Allocator, size()) : nullptr;
+            relocate_or_free(new_data, size(), m_Data, end());
+            replace_storage(new_data, size());
+        }
+    }
+
+    // modifiers methods
+    void clear() noexcept
+    {
+        destroy_tail(m_Data);
+    }
+
+    iterator insert(const_iterator position, const value_type& value)
+    {
+        return emplace(position, value);
+    }
+
+    iterator insert(const_iterator position, value_type&& value)
+    {
+        return emplace(position, std::move(value));
+    }
+
+    iterator insert(const_iterator position, size_type count, const value_type& value)
+    {
+        size_type idx = position - cbegin();
+        if (count == 0)
+        {
+            return begin() + idx;
+        }
+        if (count <= capacity() - size())
+        {
+            value_type copy(value); /// value may live in the shifted part
+            pointer pos = m_Data + idx;
+            pointer old_end = end();
+            size_type elems_after = old_end - pos;
+            if (elems_after > count)
+            {
+                m_Size = construct_range(old_end, std::make_move_iterator(old_end - count), std::make_move_iterator(old_end)) - m_Data;
+                std::move_backward(pos, old_end - count, old_end);
+                std::fill_n(pos, count, copy);
+            }
+            else
+            {
+                m_Size = construct_fill(old_end, count - elems_after, copy) - m_Data;
+                m_Size = construct_range(end(), std::make_move_iterator(pos), std::make_move_iterator(old_end)) - m_Data;
+                std::fill(pos, old_end, copy);
+            }
+        }
+        else
+        {
+            size_type new_capacity = recommend(size() + count);
+            pointer new_data = alloc_traits::allocate(m_Allocator, new_capacity);
+            try
+            {
+                construct_fill(new_data + idx, count, value);
+            }
+            catch (...)
+            {
+                alloc_traits::deallocate(m_Allocator, new_data, new_capacity);
+                throw;
+            }
+            relocate_around(new_data, new_capacity, idx, count);
+        }
+        return begin() + idx;
+    }
+
+    template <typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+    iterator insert(const_iterator position, InputIterator first, InputIterator last)
+    {
+        return insert_range(position, first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+    }
+
+    iterator insert(const_iterator position, std::initializer_list<value_type> init)
+    {
+        return insert(position, init.begin(), init.end());
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator position, Args&&... args)
+    {
+        size_type idx = position - cbegin();
+        if (size() == capacity())
+        {
+            emplace_reallocate(idx, std::forward<Args>(args)...);
+        }
+        else if (idx == size())
+        {
+            alloc_traits::construct(m_Allocator, end(), std::forward<Args>(args)...);
+            ++m_Size;
+        }
+        else
+        {
+            value_type tmp(std::forward<Args>(args)...); /// args may refer to elements being shifted
+            alloc_traits::construct(m_Allocator, end(), std::move(back()));
+            ++m_Size;
+            std::move_backward(m_Data + idx, end() - 2, end() - 1);
+            m_Data[idx] = std::move(tmp);
+        }
+        return begin() + idx;
+    }
+
+    iterator erase(const_iterator position)
+    {
+        return erase(position, position + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        pointer pos = m_Data + (first - cbegin());
+        if (first != last)
+        {
+            destroy_tail(std::move(pos + (last - first), end(), pos));
+        }
+        return pos;
+    }
+
+    void push_back(const value_type& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(value_type&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (size() == capacity())
+        {
+            emplace_reallocate(size(), std::forward<Args>(args)...);
+        }
+        else
+        {
+            alloc_traits::construct(m_Allocator, end(), std::forward<Args>(args)...);
+            ++m_Size;
+        }
+        return back();
+    }
+
+    void pop_back()
+    {
+        destroy_tail(end() - 1);
+    }
+
+    void resize(size_type new_size)
+    {
+        if (new_size > size())
+        {
+            if (new_size > capacity())
+            {
+                reserve(recommend(new_size));
+            }
+            pointer cur = end();
+            try
+            {
+                for ( ; cur != m_Data + new_size; ++cur)
+                {
+                    alloc_traits::construct(m_Allocator, cur);
+                }
+            }
+            catch (...)
+            {
+                destroy_range(end(), cur);
+                throw;
+            }
+            m_Size = new_size;
+        }
+        else
+        {
+            destroy_tail(m_Data + new_size);
+        }
+    }
+
+    void resize(size_type new_size, const value_type& value)
+    {
+        if (new_size > size())
+        {
+            insert(cend(), new_size - size(), value);
+        }
+        else
+        {
+            destroy_tail(m_Data + new_size);
+        }
+    }
+
+    void swap(vector& other) noexcept
+    {
+        using std::swap;
+        if (alloc_traits::propagate_on_container_swap::value)
+        {
+            swap(m_Allocator, other.m_Allocator);
+        }
+        swap(m_Size, other.m_Size);
+        swap(m_Capacity, other.m_Capacity);
+        swap(m_Data, other.m_Data);
+    }
+
+private:
+    size_type recommend(size_type new_size) const
+    {
+        if (new_size > max_size())
+        {
+            throw std::length_error("vector: new size is too much");
+        }
+        return std::max(new_size, std::min(capacity() * 2, max_size()));
+    }
+
+    void steal(vector& other) noexcept
+    {
+        m_Data = other.m_Data;
+        m_Size = other.m_Size;
+        m_Capacity = other.m_Capacity;
+        other.m_Data = nullptr;
+        other.m_Size = 0;
+        other.m_Capacity = 0;
+    }
+
+    void release() noexcept
+    {
+        clear();
+        if (m_Data)
+        {
+            alloc_traits::deallocate(m_Allocator, m_Data, m_Capacity);
+        }
+        m_Data = nullptr;
+        m_Capacity = 0;
+    }
+
+    void replace_storage(pointer new_data, size_type new_capacity) noexcept
+    {
+        destroy_range(m_Data, end());
+        if (m_Data)
+        {
+            alloc_traits::deallocate(m_Allocator, m_Data, m_Capacity);
+        }
+        m_Data = new_data;
+        m_Capacity = new_capacity;
+    }
+
+    void destroy_range(pointer first, pointer last) noexcept
+    {
+        for ( ; first != last; ++first)
+        {
+            alloc_traits::destroy(m_Allocator, first);
+        }
+    }
+
+    void destroy_tail(pointer new_end) noexcept
+    {
+        destroy_range(new_end, end());
+        m_Size = new_end - m_Data;
+    }
+
+    /// Constructs copies of [first, last) starting at destination, rolling back on exception
+    template <typename InputIterator>
+    pointer construct_range(pointer destination, InputIterator first, InputIterator last)
+    {
+        pointer cur = destination;
+        try
+        {
+            for ( ; first != last; ++first, ++cur)
+            {
+                alloc_traits::construct(m_Allocator, cur, *first);
+            }
+        }
+        catch (...)
+        {
+            destroy_range(destination, cur);
+            throw;
+        }
+        return cur;
+    }
+
+    pointer construct_fill(pointer destination, size_type count, const value_type& value)
+    {
+        pointer cur = destination;
+        try
+        {
+            for ( ; count > 0; --count, ++cur)
+            {
+                alloc_traits::construct(m_Allocator, cur, value);
+            }
+        }
+        catch (...)
+        {
+            destroy_range(destination, cur);
+            throw;
+        }
+        return cur;
+    }
+
+    /// Moves [first, last) to destination, or copies if the move constructor may throw,
+    /// so a failure leaves the source intact
+    pointer relocate(pointer destination, pointer first, pointer last)
+    {
+        pointer cur = destination;
+        try
+        {
+            for ( ; first != last; ++first, ++cur)
+            {
+                alloc_traits::construct(m_Allocator, cur, std::move_if_noexcept(*first));
+            }
+        }
+        catch (...)
+        {
+            destroy_range(destination, cur);
+            throw;
+        }
+        return cur;
+    }
+
+    void relocate_or_free(pointer new_data, size_type new_capacity, pointer first, pointer last)
+    {
+        try
+        {
+            relocate(new_data, first, last);
+        }
+        catch (...)
+        {
+            alloc_traits::deallocate(m_Allocator, new_data, new_capacity);
+            throw;
+        }
+    }
+
+    /// Moves the old elements around count already constructed elements at new_data + idx
+    void relocate_around(pointer new_data, size_type new_capacity, size_type idx, size_type count)
+    {
+        pointer prefix_end = new_data;
+        try
+        {
+            prefix_end = relocate(new_data, m_Data, m_Data + idx);
+            relocate(new_data + idx + count, m_Data + idx, end());
+        }
+        catch (...)
+        {
+            destroy_range(new_data, prefix_end);
+            destroy_range(new_data + idx, new_data + idx + count);
+            alloc_traits::deallocate(m_Allocator, new_data, new_capacity);
+            throw;
+        }
+        size_type new_size = size() + count;
+        replace_storage(new_data, new_capacity);
+        m_Size = new_size;
+    }
+
+    template <typename... Args>
+    void emplace_reallocate(size_type idx, Args&&... args)
+    {
+        size_type new_capacity = recommend(size() + 1);
+        pointer new_data = alloc_traits::allocate(m_Allocator, new_capacity);
+        try
+        {
+            alloc_traits::construct(m_Allocator, new_data + idx, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            alloc_traits::deallocate(m_Allocator, new_data, new_capacity);
+            throw;
+        }
+        relocate_around(new_data, new_capacity, idx, 1);
+    }
+
+    template <typename InputIterator>
+    void assign_range(InputIterator first, InputIterator last, std::input_iterator_tag)
+    {
+        pointer cur = m_Data;
+        for ( ; first != last && cur != end(); ++first, ++cur)
+        {
+            *cur = *first;
+        }
+        destroy_tail(cur);
+        for ( ; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+    }
+
+    template <typename ForwardIterator>
+    void assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+    {
+        size_type count = std::distance(first, last);
+        if (count > capacity())
+        {
+            vector tmp(m_Allocator);
+            tmp.reserve(count);
+            tmp.m_Size = tmp.construct_range(tmp.m_Data, first, last) - tmp.m_Data;
+            swap(tmp);
+        }
+        else if (count > size())
+        {
+            ForwardIterator mid = std::next(first, size());
+            std::copy(first, mid, begin());
+            m_Size = construct_range(end(), mid, last) - m_Data;
+        }
+        else
+        {
+            destroy_tail(std::copy(first, last, begin()));
+        }
+    }
+
+    template <typename InputIterator>
+    iterator insert_range(const_iterator position, InputIterator first, InputIterator last, std::input_iterator_tag)
+    {
+        size_type idx = position - cbegin();
+        size_type old_size = size();
+        for ( ; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+        std::rotate(begin() + idx, begin() + old_size, end());
+        return begin() + idx;
+    }
+
+    template <typename ForwardIterator>
+    iterator insert_range(const_iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+    {
+        size_type idx = position - cbegin();
+        size_type count = std::distance(first, last);
+        if (count == 0)
+        {
+            return begin() + idx;
+        }
+        if (count <= capacity() - size())
+        {
+            pointer pos = m_Data + idx;
+            pointer old_end = end();
+            size_type elems_after = old_end - pos;
+            if (elems_after > count)
+            {
+                m_Size = construct_range(old_end, std::make_move_iterator(old_end - count), std::make_move_iterator(old_end)) - m_Data;
+                std::move_backward(pos, old_end - count, old_end);
+                std::copy(first, last, pos);
+            }
+            else
+            {
+                ForwardIterator mid = std::next(first, elems_after);
+                m_Size = construct_range(old_end, mid, last) - m_Data;
+                m_Size = construct_range(end(), std::make_move_iterator(pos), std::make_move_iterator(old_end)) - m_Data;
+                std::copy(first, mid, pos);
+            }
+        }
+        else
+        {
+            size_type new_capacity = recommend(size() + count);
+            pointer new_data = alloc_traits::allocate(m_Allocator, new_capacity);
+            try
+            {
+                construct_range(new_data + idx, first, last);
+            }
+            catch (...)
+            {
+                alloc_traits::deallocate(m_Allocator, new_data, new_capacity);
+                throw;
+            }
+            relocate_around(new_data, new_capacity, idx, count);
+        }
+        return begin() + idx;
+    }
 };
 
+template <typename TType, typename TAlloc>
+void swap(vector<TType, TAlloc>& x, vector<TType, TAlloc>& y) noexcept(noexcept(x.swap(y)))
+{
+    x.swap(y);
+}
+
+template <typename TType, typename TAlloc>
+bool operator==(const vector<TType, TAlloc>& lhs, const vector<TType, TAlloc>& rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename TType, typename TAlloc>
+bool operator!=(const vector<TType, TAlloc>& lhs, const vector<TType, TAlloc>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename TType, typename TAlloc>
+bool operator<(const vector<TType, TAlloc>& lhs, const vector<TType, TAlloc>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename TType, typename TAlloc>
+bool operator>(const vector<TType, TAlloc>& lhs, const vector<TType, TAlloc>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename TType, typename TAlloc>
+bool operator<=(const vector<TType, TAlloc>& lhs, const vector<TType, TAlloc>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename TType, typename TAlloc>
+bool operator>=(const vector<TType, TAlloc>& lhs, const vector<TType, TAlloc>& rhs)
+{
+    return !(lhs < rhs);
+}
+
 }
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "vector_c11+.hpp"
+
+namespace ft
+{
+
+/// Chase-Lev work-stealing deque (with the weak-memory orderings of Le et al., PPoPP 2013).
+///
+/// One owner thread pushes and pops at the bottom; any number of thieves steal from the top.
+/// Only a steal racing the owner for the last element costs a CAS. The ring doubles when
+/// full, and the outgrown rings are kept until destruction since a thief may still be
+/// reading one. Values are read before the CAS that claims them, so TType must be
+/// trivially copyable: task pointers, indices, small PODs.
+template <typename TType, typename TAllocator = std::allocator<TType>>
+class work_stealing_deque
+{
+    static_assert(std::is_trivially_copyable<TType>::value, "work_stealing_deque: TType must be trivially copyable");
+
+public:
+    using value_type = TType;
+    using allocator_type = TAllocator;
+    using size_type = std::size_t;
+
+private:
+    using index_type = std::int64_t;
+
+    /// Power-of-two ring of atomic slots, indexed by the unwrapped position
+    struct ring
+    {
+        index_type m_Capacity;
+        std::atomic<value_type>* m_Slots;
+
+        value_type get(index_type position) const noexcept
+        {
+            return m_Slots[position & (m_Capacity - 1)].load(std::memory_order_relaxed);
+        }
+
+        void put(index_type position, const value_type& value) noexcept
+        {
+            m_Slots[position & (m_Capacity - 1)].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    using slot_type = std::atomic<value_type>;
+    using slot_allocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<slot_type>;
+    using slot_traits = std::allocator_traits<slot_allocator>;
+
+    slot_allocator m_Allocator;
+    std::atomic<index_type> m_Top;
+    std::atomic<index_type> m_Bottom;
+    std::atomic<ring*> m_Ring;
+    vector<ring*> m_Retired; /// owner only
+
+public:
+    explicit work_stealing_deque(size_type capacity = 64, const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_Top(0)
+        , m_Bottom(0)
+        , m_Ring(nullptr)
+    {
+        size_type rounded = 1;
+        while (rounded < capacity)
+        {
+            rounded *= 2;
+        }
+        m_Ring.store(make_ring(static_cast<index_type>(rounded)), std::memory_order_relaxed);
+    }
+
+    work_stealing_deque(const work_stealing_deque&) = delete;
+    work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+    ~work_stealing_deque()
+    {
+        free_ring(m_Ring.load(std::memory_order_relaxed));
+        for (ring* old : m_Retired)
+        {
+            free_ring(old);
+        }
+    }
+
+    /// Approximate while other threads are active
+    size_type size() const noexcept
+    {
+        index_type count = m_Bottom.load(std::memory_order_relaxed) - m_Top.load(std::memory_order_relaxed);
+        return count > 0 ? static_cast<size_type>(count) : 0;
+    }
+
+    bool empty() const noexcept { return size() == 0; }
+    size_type capacity() const noexcept { return static_cast<size_type>(m_Ring.load(std::memory_order_relaxed)->m_Capacity); }
+
+    void push(const value_type& value) /// owner only
+    {
+        index_type bottom = m_Bottom.load(std::memory_order_relaxed);
+        index_type top = m_Top.load(std::memory_order_acquire);
+        ring* current = m_Ring.load(std::memory_order_relaxed);
+        if (bottom - top > current->m_Capacity - 1)
+        {
+            current = grow(current, top, bottom);
+        }
+        current->put(bottom, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    bool try_pop(value_type& out) noexcept /// owner only, newest first
+    {
+        index_type bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        ring* current = m_Ring.load(std::memory_order_relaxed);
+        m_Bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        index_type top = m_Top.load(std::memory_order_relaxed);
+        if (top > bottom)
+        {
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+        out = current->get(bottom);
+        if (top == bottom) /// last element, race the thieves for it
+        {
+            bool won = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /// Any thread, oldest first. False when empty or when another thread claimed the element first.
+    bool try_steal(value_type& out) noexcept
+    {
+        index_type top = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        index_type bottom = m_Bottom.load(std::memory_order_acquire);
+        if (top >= bottom)
+        {
+            return false;
+        }
+        value_type value = m_Ring.load(std::memory_order_acquire)->get(top);
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;
+        }
+        out = value;
+        return true;
+    }
+
+private:
+    ring* make_ring(index_type capacity)
+    {
+        slot_type* slots = slot_traits::allocate(m_Allocator, static_cast<size_type>(capacity));
+        for (index_type i = 0; i < capacity; ++i)
+        {
+            ::new (static_cast<void*>(slots + i)) slot_type();
+        }
+        try
+        {
+            return new ring{capacity, slots};
+        }
+        catch (...)
+        {
+            slot_traits::deallocate(m_Allocator, slots, static_cast<size_type>(capacity));
+            throw;
+        }
+    }
+
+    void free_ring(ring* old) noexcept
+    {
+        slot_traits::deallocate(m_Allocator, old->m_Slots, static_cast<size_type>(old->m_Capacity));
+        delete old;
+    }
+
+    ring* grow(ring* current, index_type top, index_type bottom) /// doubles, like vector growth, keeping positions
+    {
+        m_Retired.reserve(m_Retired.size() + 1);
+        ring* bigger = make_ring(current->m_Capacity * 2);
+        for (index_type i = top; i < bottom; ++i)
+        {
+            bigger->put(i, current->get(i));
+        }
+        m_Retired.push_back(current);
+        m_Ring.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+};
+
+}
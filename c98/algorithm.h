@@ -27,7 +27,7 @@ bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
 template <typename InputIterator1, typename InputIterator2, typename Compare>
 bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, Compare comp)
 {
-    for ( ; first1 != last1 || first2 != last2; ++first1, ++first2)
+    for ( ; first1 != last1 && first2 != last2; ++first1, ++first2)
     {
         if (comp(*first1, *first2))
         {
@@ -44,7 +44,30 @@ bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputI
 template <typename InputIterator1, typename InputIterator2>
 bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
 {
-    return ft::equal(first1, last1, first2, last2, less<void>());
+    return ft::lexicographical_compare(first1, last1, first2, last2, less<void>());
+}
+
+/// erase_if for contiguous sequences: a stable compaction in one pass, then one erase of the tail
+template <typename TContainer, typename Predicate>
+typename TContainer::size_type erase_if_compact(TContainer& c, Predicate pred)
+{
+    typename TContainer::iterator last = c.end();
+    typename TContainer::iterator kept = c.begin();
+    while (kept != last && !pred(*kept))
+    {
+        ++kept;
+    }
+    for (typename TContainer::iterator it = kept; it != last; ++it)
+    {
+        if (!pred(*it))
+        {
+            *kept = *it;
+            ++kept;
+        }
+    }
+    typename TContainer::size_type removed = last - kept;
+    c.erase(kept, last);
+    return removed;
 }
 
 }
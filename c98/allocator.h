@@ -0,0 +1,442 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "type_traits.h"
+
+namespace ft
+{
+
+/// Allocators with an extra reallocate(p, old_n, new_n) member. It may move the block,
+/// contents are kept bitwise, so containers use it only for trivially copyable elements.
+
+template <typename TType>
+class malloc_allocator
+{
+public:
+    typedef TType value_type;
+    typedef TType* pointer;
+    typedef const TType* const_pointer;
+    typedef TType& reference;
+    typedef const TType& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename TOther>
+    struct rebind
+    {
+        typedef malloc_allocator<TOther> other;
+    };
+
+public:
+    malloc_allocator() {}
+
+    template <typename TOther>
+    malloc_allocator(const malloc_allocator<TOther>&) {}
+
+    pointer address(reference x) const { return &x; }
+    const_pointer address(const_reference x) const { return &x; }
+
+    pointer allocate(size_type n, const void* = NULL)
+    {
+        if (n == 0)
+        {
+            return NULL;
+        }
+        pointer p = static_cast<pointer>(std::malloc(n * sizeof(value_type)));
+        if (p == NULL)
+        {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+
+    void deallocate(pointer p, size_type)
+    {
+        std::free(p);
+    }
+
+    pointer reallocate(pointer p, size_type, size_type new_n) /// realloc grows in place or lets the kernel move pages
+    {
+        pointer new_p = static_cast<pointer>(std::realloc(p, new_n * sizeof(value_type)));
+        if (new_p == NULL && new_n != 0)
+        {
+            throw std::bad_alloc();
+        }
+        return new_p;
+    }
+
+    size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(value_type); }
+
+    void construct(pointer p, const_reference val) { new (static_cast<void*>(p)) value_type(val); }
+    void destroy(pointer p) { p->~value_type(); }
+};
+
+template <typename TLeft, typename TRight>
+bool operator==(const malloc_allocator<TLeft>&, const malloc_allocator<TRight>&) { return true; }
+
+template <typename TLeft, typename TRight>
+bool operator!=(const malloc_allocator<TLeft>&, const malloc_allocator<TRight>&) { return false; }
+
+/// Takes whole pages straight from mmap, growing them with mremap without copying
+template <typename TType>
+class page_allocator
+{
+public:
+    typedef TType value_type;
+    typedef TType* pointer;
+    typedef const TType* const_pointer;
+    typedef TType& reference;
+    typedef const TType& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename TOther>
+    struct rebind
+    {
+        typedef page_allocator<TOther> other;
+    };
+
+public:
+    page_allocator() {}
+
+    template <typename TOther>
+    page_allocator(const page_allocator<TOther>&) {}
+
+    pointer address(reference x) const { return &x; }
+    const_pointer address(const_reference x) const { return &x; }
+
+    pointer allocate(size_type n, const void* = NULL)
+    {
+        if (n == 0)
+        {
+            return NULL;
+        }
+        void* p = mmap(NULL, bytes(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<pointer>(p);
+    }
+
+    void deallocate(pointer p, size_type n)
+    {
+        if (p != NULL)
+        {
+            munmap(p, bytes(n));
+        }
+    }
+
+    pointer reallocate(pointer p, size_type old_n, size_type new_n)
+    {
+        if (p == NULL)
+        {
+            return allocate(new_n);
+        }
+        if (new_n == 0)
+        {
+            deallocate(p, old_n);
+            return NULL;
+        }
+        if (bytes(old_n) == bytes(new_n))
+        {
+            return p;
+        }
+#ifdef MREMAP_MAYMOVE
+        void* new_p = mremap(p, bytes(old_n), bytes(new_n), MREMAP_MAYMOVE);
+        if (new_p == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<pointer>(new_p);
+#else
+        pointer new_p = allocate(new_n);
+        std::memcpy(new_p, p, (old_n < new_n ? old_n : new_n) * sizeof(value_type));
+        deallocate(p, old_n);
+        return new_p;
+#endif
+    }
+
+    size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(value_type); }
+
+    void construct(pointer p, const_reference val) { new (static_cast<void*>(p)) value_type(val); }
+    void destroy(pointer p) { p->~value_type(); }
+
+private:
+    static size_type bytes(size_type n)
+    {
+        static const size_type page_size = sysconf(_SC_PAGESIZE);
+        return (n * sizeof(value_type) + page_size - 1) / page_size * page_size;
+    }
+};
+
+template <typename TLeft, typename TRight>
+bool operator==(const page_allocator<TLeft>&, const page_allocator<TRight>&) { return true; }
+
+template <typename TLeft, typename TRight>
+bool operator!=(const page_allocator<TLeft>&, const page_allocator<TRight>&) { return false; }
+
+/// Blocks aligned to Align bytes (at least alignof(TType)), e.g. cache lines for vectorized loops
+template <typename TType, std::size_t Align = 64>
+class aligned_allocator
+{
+public:
+    typedef TType value_type;
+    typedef TType* pointer;
+    typedef const TType* const_pointer;
+    typedef TType& reference;
+    typedef const TType& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    static const size_type alignment = Align < alignof(TType) ? alignof(TType) : Align;
+
+    template <typename TOther>
+    struct rebind
+    {
+        typedef aligned_allocator<TOther, Align> other;
+    };
+
+public:
+    aligned_allocator() {}
+
+    template <typename TOther>
+    aligned_allocator(const aligned_allocator<TOther, Align>&) {}
+
+    pointer address(reference x) const { return &x; }
+    const_pointer address(const_reference x) const { return &x; }
+
+    pointer allocate(size_type n, const void* = NULL)
+    {
+        if (n == 0)
+        {
+            return NULL;
+        }
+        if (n > max_size())
+        {
+            throw std::bad_alloc();
+        }
+        void* p = NULL;
+        if (posix_memalign(&p, alignment, n * sizeof(value_type)) != 0)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<pointer>(p);
+    }
+
+    void deallocate(pointer p, size_type)
+    {
+        std::free(p);
+    }
+
+    size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(value_type); }
+
+    void construct(pointer p, const_reference val) { new (static_cast<void*>(p)) value_type(val); }
+    void destroy(pointer p) { p->~value_type(); }
+};
+
+template <typename TType, std::size_t Align>
+const std::size_t aligned_allocator<TType, Align>::alignment;
+
+template <typename TLeft, typename TRight, std::size_t Align>
+bool operator==(const aligned_allocator<TLeft, Align>&, const aligned_allocator<TRight, Align>&) { return true; }
+
+template <typename TLeft, typename TRight, std::size_t Align>
+bool operator!=(const aligned_allocator<TLeft, Align>&, const aligned_allocator<TRight, Align>&) { return false; }
+
+/// Blocks of at least one huge page are mmapped on a 2 MB boundary and advised for
+/// transparent huge pages (plain pages where THP is off), or come from the heap on the
+/// same boundary when mmap fails; smaller ones (tree nodes, short vectors) come from
+/// aligned_allocator.
+template <typename TType>
+class huge_page_allocator
+{
+public:
+    typedef TType value_type;
+    typedef TType* pointer;
+    typedef const TType* const_pointer;
+    typedef TType& reference;
+    typedef const TType& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    static const size_type huge_page_size = 2 * 1024 * 1024;
+
+    template <typename TOther>
+    struct rebind
+    {
+        typedef huge_page_allocator<TOther> other;
+    };
+
+public:
+    huge_page_allocator() {}
+
+    template <typename TOther>
+    huge_page_allocator(const huge_page_allocator<TOther>&) {}
+
+    pointer address(reference x) const { return &x; }
+    const_pointer address(const_reference x) const { return &x; }
+
+    pointer allocate(size_type n, const void* = NULL)
+    {
+        if (n > max_size())
+        {
+            throw std::bad_alloc();
+        }
+        if (!is_huge(n))
+        {
+            return aligned_allocator<TType>().allocate(n);
+        }
+        char* block = map_block(bytes(n));
+        if (block == NULL) /// out of mappings or address space for mmap: a heap block on the same boundary
+        {
+            block = heap_allocator().allocate(huge_page_size + bytes(n)) + huge_page_size;
+            origin(block) = from_heap;
+        }
+        return reinterpret_cast<pointer>(block);
+    }
+
+    void deallocate(pointer p, size_type n)
+    {
+        if (p == NULL)
+        {
+            return;
+        }
+        if (!is_huge(n))
+        {
+            aligned_allocator<TType>().deallocate(p, n);
+            return;
+        }
+        char* block = reinterpret_cast<char*>(p);
+        if (origin(block) == from_mmap)
+        {
+            munmap(block - page_size(), page_size() + bytes(n));
+        }
+        else
+        {
+            heap_allocator().deallocate(block - huge_page_size, huge_page_size + bytes(n));
+        }
+    }
+
+    size_type max_size() const { return (std::numeric_limits<size_type>::max() - 2 * huge_page_size) / sizeof(value_type); }
+
+    void construct(pointer p, const_reference val) { new (static_cast<void*>(p)) value_type(val); }
+    void destroy(pointer p) { p->~value_type(); }
+
+private:
+    typedef aligned_allocator<char, huge_page_size> heap_allocator;
+
+    /// Every huge block is preceded by a word saying where it came from, in a page of its own
+    enum block_origin { from_mmap = 1, from_heap = 2 };
+
+    static std::size_t& origin(char* block) { return reinterpret_cast<std::size_t*>(block)[-1]; }
+    static size_type page_size() { return static_cast<size_type>(sysconf(_SC_PAGESIZE)); }
+
+    /// mmap only guarantees page alignment: over-map by one huge page, keep the page before
+    /// the 2 MB boundary for the origin word and trim the rest
+    static char* map_block(size_type length)
+    {
+        size_type page = page_size();
+        size_type mapped = page + length + huge_page_size;
+        char* raw = static_cast<char*>(mmap(NULL, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if (raw == MAP_FAILED)
+        {
+            return NULL;
+        }
+        std::size_t first = reinterpret_cast<std::size_t>(raw) + page;
+        char* block = raw + page + (huge_page_size - first % huge_page_size) % huge_page_size;
+        if (block - page != raw)
+        {
+            munmap(raw, block - page - raw);
+        }
+        if (block + length != raw + mapped)
+        {
+            munmap(block + length, raw + mapped - (block + length));
+        }
+#ifdef MADV_HUGEPAGE
+        madvise(block, length, MADV_HUGEPAGE);
+#endif
+        origin(block) = from_mmap;
+        return block;
+    }
+
+    static bool is_huge(size_type n) { return n * sizeof(value_type) >= huge_page_size; }
+
+    static size_type bytes(size_type n)
+    {
+        return (n * sizeof(value_type) + huge_page_size - 1) / huge_page_size * huge_page_size;
+    }
+};
+
+template <typename TType>
+const std::size_t huge_page_allocator<TType>::huge_page_size;
+
+template <typename TLeft, typename TRight>
+bool operator==(const huge_page_allocator<TLeft>&, const huge_page_allocator<TRight>&) { return true; }
+
+template <typename TLeft, typename TRight>
+bool operator!=(const huge_page_allocator<TLeft>&, const huge_page_allocator<TRight>&) { return false; }
+
+/// Adaptor whose argument-less construct default-initializes, so value-initializing
+/// resize(n) of allocator-aware containers leaves trivial elements uninitialized
+template <typename TType, typename TBase = std::allocator<TType> >
+class default_init_allocator : public TBase
+{
+    typedef std::allocator_traits<TBase> base_traits;
+
+public:
+    template <typename TOther>
+    struct rebind
+    {
+        typedef default_init_allocator<TOther, typename base_traits::template rebind_alloc<TOther> > other;
+    };
+
+public:
+    default_init_allocator() {}
+
+    default_init_allocator(const TBase& base) : TBase(base) {}
+
+    template <typename TOther, typename TOtherBase>
+    default_init_allocator(const default_init_allocator<TOther, TOtherBase>& other) : TBase(other) {}
+
+    template <typename TOther>
+    void construct(TOther* p)
+    {
+        ::new (static_cast<void*>(p)) TOther;
+    }
+
+    template <typename TOther, typename... Args>
+    void construct(TOther* p, Args&&... args)
+    {
+        base_traits::construct(static_cast<TBase&>(*this), p, std::forward<Args>(args)...);
+    }
+};
+
+template <typename Alloc>
+struct has_reallocate_helper
+{
+private:
+    template <typename A, typename = decltype(declval<A&>().reallocate(declval<typename A::pointer>(), 0, 0))>
+    static true_type dummy(void*);
+
+    template <typename>
+    static false_type dummy(...);
+
+public:
+    typedef decltype(dummy<Alloc>(NULL)) type;
+};
+
+template <typename Alloc>
+struct has_reallocate : has_reallocate_helper<Alloc>::type
+{};
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cassert>
+#include <iterator>
+
+#include "static_vector.h"
+
+namespace ft
+{
+
+/// Collects values in a local buffer of about BatchBytes and hands them to the container's
+/// range insert at its end a batch at a time, so pipelines that produce one element per
+/// step pay one capacity check per batch. Call flush() before the buffer goes away:
+/// a failing insert has to reach the caller, so the destructor only asserts it is empty.
+template <typename TContainer, std::size_t BatchBytes = 4096>
+class back_insert_buffer
+{
+public:
+    typedef TContainer container_type;
+    typedef typename TContainer::value_type value_type;
+
+    static const std::size_t batch_size = sizeof(value_type) < BatchBytes ? BatchBytes / sizeof(value_type) : 1;
+
+    class iterator /// output iterator feeding the buffer
+    {
+        back_insert_buffer* m_Buffer;
+
+    public:
+        typedef std::output_iterator_tag iterator_category;
+        typedef void value_type;
+        typedef void difference_type;
+        typedef void pointer;
+        typedef void reference;
+
+        explicit iterator(back_insert_buffer& buffer) : m_Buffer(&buffer) {}
+
+        iterator& operator=(const typename TContainer::value_type& val)
+        {
+            m_Buffer->push_back(val);
+            return *this;
+        }
+
+        iterator& operator*() { return *this; }
+        iterator& operator++() { return *this; }
+        iterator operator++(int) { return *this; }
+    };
+
+private:
+    TContainer& m_Container;
+    static_vector<value_type, batch_size, static_vector_assert> m_Pending; /// push_back checks full() itself
+
+    back_insert_buffer(const back_insert_buffer&);
+    back_insert_buffer& operator=(const back_insert_buffer&);
+
+public:
+    explicit back_insert_buffer(TContainer& container) : m_Container(container) {}
+
+    ~back_insert_buffer()
+    {
+        assert(m_Pending.empty() && "back_insert_buffer: flush() before destruction");
+    }
+
+    void push_back(const value_type& val)
+    {
+        if (m_Pending.full())
+        {
+            flush();
+        }
+        m_Pending.push_back(val);
+    }
+
+    void flush()
+    {
+        m_Container.insert(m_Container.end(), m_Pending.data(), m_Pending.data() + m_Pending.size());
+        m_Pending.clear();
+    }
+
+    iterator inserter() { return iterator(*this); }
+};
+
+template <typename TContainer, std::size_t BatchBytes>
+const std::size_t back_insert_buffer<TContainer, BatchBytes>::batch_size;
+
+}
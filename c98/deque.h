@@ -0,0 +1,464 @@
+#pragma once
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "index_iter.h"
+#include "reverse_iter.h"
+#include "algorithm.h"
+#include "memory.h"
+
+namespace ft
+{
+
+/// Double-ended queue on fixed blocks. The map is an array of block pointers with free slots
+/// at both ends, so pushing at either end allocates at most one block and never moves
+/// elements. Element i lives at absolute slot m_Start + i counted from the start of the map.
+template <typename TType, typename TAllocator = std::allocator<TType> >
+class deque
+{
+public:
+    typedef TType value_type;
+    typedef TAllocator allocator_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename allocator_type::reference reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer pointer;
+    typedef typename allocator_type::const_pointer const_pointer;
+    typedef IndexIterator<deque, false> iterator;
+    typedef IndexIterator<deque, true> const_iterator;
+    typedef ReverseIterator<iterator> reverse_iterator;
+    typedef ReverseIterator<const_iterator> const_reverse_iterator;
+
+    /// about 4 KB per block, but at least 16 elements for large types
+    static const size_type block_size = sizeof(TType) < 256 ? 4096 / sizeof(TType) : 16;
+
+private:
+    typedef typename allocator_type::template rebind<pointer>::other map_allocator;
+
+    allocator_type m_Allocator;
+    map_allocator m_MapAllocator;
+    pointer* m_Map;
+    size_type m_MapCapacity;
+    size_type m_MapBegin; /// blocks are allocated in map[m_MapBegin, m_MapEnd), the rest is NULL
+    size_type m_MapEnd;
+    size_type m_Start;
+    size_type m_Size;
+
+public:
+    explicit deque(const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_MapAllocator(alloc)
+        , m_Map(NULL)
+        , m_MapCapacity(0)
+        , m_MapBegin(0)
+        , m_MapEnd(0)
+        , m_Start(0)
+        , m_Size(0)
+    {}
+
+    explicit deque(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_MapAllocator(alloc)
+        , m_Map(NULL)
+        , m_MapCapacity(0)
+        , m_MapBegin(0)
+        , m_MapEnd(0)
+        , m_Start(0)
+        , m_Size(0)
+    {
+        try
+        {
+            resize(count, value);
+        }
+        catch (...)
+        {
+            release_all();
+            throw;
+        }
+    }
+
+    template <typename InputIterator>
+    deque(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+          typename enable_if<!is_integral<InputIterator>::value>::type* = NULL)
+        : m_Allocator(alloc)
+        , m_MapAllocator(alloc)
+        , m_Map(NULL)
+        , m_MapCapacity(0)
+        , m_MapBegin(0)
+        , m_MapEnd(0)
+        , m_Start(0)
+        , m_Size(0)
+    {
+        try
+        {
+            assign(first, last);
+        }
+        catch (...)
+        {
+            release_all();
+            throw;
+        }
+    }
+
+    deque(const deque& other)
+        : m_Allocator(other.m_Allocator)
+        , m_MapAllocator(other.m_MapAllocator)
+        , m_Map(NULL)
+        , m_MapCapacity(0)
+        , m_MapBegin(0)
+        , m_MapEnd(0)
+        , m_Start(0)
+        , m_Size(0)
+    {
+        try
+        {
+            assign(other.begin(), other.end());
+        }
+        catch (...)
+        {
+            release_all();
+            throw;
+        }
+    }
+
+    deque& operator=(const deque& other)
+    {
+        if (&other != this)
+        {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    ~deque()
+    {
+        release_all();
+    }
+
+    allocator_type get_allocator() const
+    {
+        return m_Allocator;
+    }
+
+    // iterator methods
+    iterator begin() { return iterator(this, 0); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    iterator end() { return iterator(this, m_Size); }
+    const_iterator end() const { return const_iterator(this, m_Size); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    // capacity methods
+    size_type size() const { return m_Size; }
+    size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(value_type); }
+    bool empty() const { return m_Size == 0; }
+
+    void resize(size_type new_size, const value_type& val = value_type())
+    {
+        while (m_Size < new_size)
+        {
+            push_back(val);
+        }
+        while (m_Size > new_size)
+        {
+            pop_back();
+        }
+    }
+
+    void shrink_to_fit() /// frees the spare blocks at both ends
+    {
+        size_type first_used = m_Start / block_size;
+        size_type last_used = m_Size == 0 ? first_used : (m_Start + m_Size - 1) / block_size + 1;
+        if (first_used > m_MapBegin)
+        {
+            release_blocks(m_MapBegin, first_used);
+            m_MapBegin = first_used;
+        }
+        if (m_MapEnd > last_used)
+        {
+            release_blocks(last_used, m_MapEnd);
+            m_MapEnd = last_used;
+        }
+        if (m_Size == 0)
+        {
+            m_Start = m_MapBegin * block_size;
+        }
+    }
+
+    // element access methods
+    reference operator[](size_type position) { return *slot(m_Start + position); }
+    const_reference operator[](size_type position) const { return *slot(m_Start + position); }
+
+    reference at(size_type position)
+    {
+        if (position >= m_Size)
+        {
+            throw std::out_of_range("out of range of deque");
+        }
+        return (*this)[position];
+    }
+
+    const_reference at(size_type position) const
+    {
+        if (position >= m_Size)
+        {
+            throw std::out_of_range("out of range of deque");
+        }
+        return (*this)[position];
+    }
+
+    reference front() { return *slot(m_Start); }
+    const_reference front() const { return *slot(m_Start); }
+    reference back() { return *slot(m_Start + m_Size - 1); }
+    const_reference back() const { return *slot(m_Start + m_Size - 1); }
+
+    // modifiers methods
+    void assign(size_type count, const value_type& val)
+    {
+        value_type copy(val); /// val may be one of our elements
+        clear();
+        resize(count, copy);
+    }
+
+    template <typename InputIterator>
+    typename enable_if<!is_integral<InputIterator>::value>::type
+    assign(InputIterator first, InputIterator last)
+    {
+        clear();
+        for (; first != last; ++first)
+        {
+            push_back(*first);
+        }
+    }
+
+    void push_back(const value_type& val)
+    {
+        size_type position = m_Start + m_Size;
+        if (position == m_MapEnd * block_size)
+        {
+            if (m_MapEnd == m_MapCapacity)
+            {
+                position += grow_map();
+            }
+            m_Map[m_MapEnd] = m_Allocator.allocate(block_size);
+            ++m_MapEnd;
+        }
+        m_Allocator.construct(slot(position), val); /// elements never move, so val stays valid
+        ++m_Size;
+    }
+
+    void push_front(const value_type& val)
+    {
+        if (m_Start == m_MapBegin * block_size)
+        {
+            if (m_MapBegin == 0)
+            {
+                grow_map();
+            }
+            m_Map[m_MapBegin - 1] = m_Allocator.allocate(block_size);
+            --m_MapBegin;
+        }
+        m_Allocator.construct(slot(m_Start - 1), val);
+        --m_Start;
+        ++m_Size;
+    }
+
+    void pop_back()
+    {
+        --m_Size;
+        m_Allocator.destroy(slot(m_Start + m_Size));
+        /// keep one spare block at the end so push/pop at a block edge doesn't thrash the allocator
+        if (m_MapEnd - m_MapBegin > 1 && m_Start + m_Size + 2 * block_size <= m_MapEnd * block_size)
+        {
+            --m_MapEnd;
+            release_blocks(m_MapEnd, m_MapEnd + 1);
+        }
+    }
+
+    void pop_front()
+    {
+        m_Allocator.destroy(slot(m_Start));
+        ++m_Start;
+        --m_Size;
+        if (m_MapEnd - m_MapBegin > 1 && (m_MapBegin + 2) * block_size <= m_Start)
+        {
+            release_blocks(m_MapBegin, m_MapBegin + 1);
+            ++m_MapBegin;
+        }
+    }
+
+    void swap(deque& x)
+    {
+        deque tmp_state(m_Allocator); /// plain member swap through an empty deque
+        tmp_state.take(*this);
+        take(x);
+        x.take(tmp_state);
+    }
+
+    void clear() /// keeps the blocks for reuse
+    {
+        size_type position = m_Start;
+        size_type end_position = m_Start + m_Size;
+        while (position < end_position)
+        {
+            size_type block_end = (position / block_size + 1) * block_size;
+            size_type run_end = block_end < end_position ? block_end : end_position;
+            ft::destroy_n(m_Allocator, slot(position), run_end - position);
+            position = run_end;
+        }
+        m_Size = 0;
+        m_Start = (m_MapBegin + (m_MapEnd - m_MapBegin) / 2) * block_size;
+    }
+
+private:
+    pointer slot(size_type position) const
+    {
+        return m_Map[position / block_size] + position % block_size;
+    }
+
+    /// Destroys the elements and frees every block and the map; a constructor unwinds through it.
+    void release_all()
+    {
+        clear();
+        release_blocks(m_MapBegin, m_MapEnd);
+        if (m_Map != NULL)
+        {
+            m_MapAllocator.deallocate(m_Map, m_MapCapacity);
+        }
+    }
+
+    void release_blocks(size_type first, size_type last)
+    {
+        for (size_type i = first; i < last; ++i)
+        {
+            m_Allocator.deallocate(m_Map[i], block_size);
+            m_Map[i] = NULL;
+        }
+    }
+
+    /// Recentres the used part of the map, doubling the map when it is more than half full.
+    /// Returns by how many slots absolute positions moved.
+    size_type grow_map()
+    {
+        size_type used = m_MapEnd - m_MapBegin;
+        pointer* new_map = m_Map;
+        size_type new_capacity = m_MapCapacity;
+        if (used * 2 >= m_MapCapacity)
+        {
+            new_capacity = m_MapCapacity < 4 ? 8 : m_MapCapacity * 2;
+            new_map = m_MapAllocator.allocate(new_capacity);
+            std::memset(static_cast<void*>(new_map), 0, new_capacity * sizeof(pointer));
+        }
+        size_type new_begin = (new_capacity - used) / 2;
+        if (used != 0)
+        {
+            std::memmove(static_cast<void*>(new_map + new_begin), static_cast<const void*>(m_Map + m_MapBegin), used * sizeof(pointer));
+        }
+        if (new_map != m_Map)
+        {
+            if (m_Map != NULL)
+            {
+                m_MapAllocator.deallocate(m_Map, m_MapCapacity);
+            }
+        }
+        else
+        {
+            for (size_type i = 0; i < new_capacity; ++i)
+            {
+                if (i < new_begin || i >= new_begin + used)
+                {
+                    new_map[i] = NULL;
+                }
+            }
+        }
+        size_type shift = (new_begin - m_MapBegin) * block_size; /// wraps when moving left, which unsigned arithmetic undoes
+        m_Map = new_map;
+        m_MapCapacity = new_capacity;
+        m_MapBegin = new_begin;
+        m_MapEnd = new_begin + used;
+        m_Start += shift;
+        return shift;
+    }
+
+    void take(deque& other)
+    {
+        m_Allocator = other.m_Allocator;
+        m_MapAllocator = other.m_MapAllocator;
+        m_Map = other.m_Map;
+        m_MapCapacity = other.m_MapCapacity;
+        m_MapBegin = other.m_MapBegin;
+        m_MapEnd = other.m_MapEnd;
+        m_Start = other.m_Start;
+        m_Size = other.m_Size;
+
+        other.m_Map = NULL;
+        other.m_MapCapacity = 0;
+        other.m_MapBegin = 0;
+        other.m_MapEnd = 0;
+        other.m_Start = 0;
+        other.m_Size = 0;
+    }
+};
+
+template <typename TType, typename TAlloc>
+struct is_trivially_relocatable<deque<TType, TAlloc> > : is_trivially_relocatable<TAlloc>
+{};
+
+template <typename TType, typename TAllocator>
+const std::size_t deque<TType, TAllocator>::block_size;
+
+template <typename TType, typename TAlloc>
+void swap(deque<TType, TAlloc>& x, deque<TType, TAlloc>& y)
+{
+    x.swap(y);
+}
+
+template <typename TType, typename TAlloc>
+bool operator==(const deque<TType, TAlloc>& lhs, const deque<TType, TAlloc>& rhs)
+{
+    return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename TType, typename TAlloc>
+bool operator!=(const deque<TType, TAlloc>& lhs, const deque<TType, TAlloc>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename TType, typename TAlloc>
+bool operator<(const deque<TType, TAlloc>& lhs, const deque<TType, TAlloc>& rhs)
+{
+    return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename TType, typename TAlloc>
+bool operator>(const deque<TType, TAlloc>& lhs, const deque<TType, TAlloc>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename TType, typename TAlloc>
+bool operator<=(const deque<TType, TAlloc>& lhs, const deque<TType, TAlloc>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename TType, typename TAlloc>
+bool operator>=(const deque<TType, TAlloc>& lhs, const deque<TType, TAlloc>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+}
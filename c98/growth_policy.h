@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ft
+{
+
+/// Growth policies for vector. next_capacity returns a capacity of at least required elements;
+/// the container clamps it to max_size. shrink_capacity is asked after elements are removed
+/// and returns the capacity to shrink to, or the current one to keep it.
+
+struct no_auto_shrink
+{
+    static std::size_t shrink_capacity(std::size_t, std::size_t capacity)
+    {
+        return capacity;
+    }
+};
+
+struct growth_doubling : no_auto_shrink
+{
+    static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t)
+    {
+        std::size_t grown = capacity * 2;
+        return grown < capacity || grown < required ? required : grown;
+    }
+};
+
+struct growth_one_and_half : no_auto_shrink
+{
+    static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t)
+    {
+        std::size_t grown = capacity + capacity / 2;
+        return grown < capacity || grown < required ? required : grown;
+    }
+};
+
+/// 1.5x growth rounded up to the jemalloc size class of the block, so the slack the
+/// allocator would hand out anyway becomes usable capacity
+struct growth_size_class : no_auto_shrink
+{
+    static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t elem_size)
+    {
+        std::size_t wanted = growth_one_and_half::next_capacity(capacity, required, elem_size);
+        std::size_t bytes = round_to_class(wanted * elem_size);
+        if (bytes / elem_size < wanted)
+        {
+            return wanted;
+        }
+        return bytes / elem_size;
+    }
+
+    static std::size_t round_to_class(std::size_t bytes)
+    {
+        if (bytes <= 16)
+        {
+            return bytes <= 8 ? 8 : 16;
+        }
+        std::size_t lg = 0;
+        for (std::size_t rest = bytes - 1; rest > 1; rest >>= 1)
+        {
+            ++lg;
+        }
+        std::size_t delta = std::size_t(1) << (lg < 6 ? 4 : lg - 2); /// four classes per doubling
+        std::size_t rounded = (bytes + delta - 1) & ~(delta - 1);
+        return rounded < bytes ? bytes : rounded;
+    }
+};
+
+struct growth_exact : no_auto_shrink
+{
+    static std::size_t next_capacity(std::size_t, std::size_t required, std::size_t)
+    {
+        return required;
+    }
+};
+
+/// Opt-in: once size drops below a quarter of capacity, shrink to twice the size so the next
+/// few insertions don't immediately grow again. Shrinking invalidates iterators on erase/pop_back.
+template <typename TGrowth = growth_doubling>
+struct auto_shrink : TGrowth
+{
+    static std::size_t shrink_capacity(std::size_t size, std::size_t capacity)
+    {
+        return size < capacity / 4 ? size * 2 : capacity;
+    }
+};
+
+}
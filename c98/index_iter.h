@@ -0,0 +1,118 @@
+#pragma once
+
+#include "iterator_traits.h"
+#include "type_traits.h"
+
+namespace ft
+{
+
+/// Random-access iterator over containers whose storage is not one array: it keeps the
+/// container and a position and reads through container[position]. It stays valid while
+/// the container grows, because it never caches element addresses.
+template <typename TContainer, bool Const>
+class IndexIterator
+{
+public:
+    typedef random_access_iterator_tag iterator_category;
+    typedef typename TContainer::value_type value_type;
+    typedef typename TContainer::size_type size_type;
+    typedef typename TContainer::difference_type difference_type;
+    typedef typename conditional<Const, const value_type*, value_type*>::type pointer;
+    typedef typename conditional<Const, const value_type&, value_type&>::type reference;
+    typedef typename conditional<Const, const TContainer*, TContainer*>::type container_pointer;
+
+private:
+    container_pointer m_Container;
+    size_type m_Index;
+
+public:
+    IndexIterator() : m_Container(NULL), m_Index(0) {}
+    IndexIterator(container_pointer container, size_type index) : m_Container(container), m_Index(index) {}
+
+    template <bool OtherConst>
+    IndexIterator(const IndexIterator<TContainer, OtherConst>& other,
+                  typename enable_if<Const && !OtherConst>::type* = NULL)
+        : m_Container(other.container())
+        , m_Index(other.index())
+    {}
+
+    container_pointer container() const { return m_Container; }
+    size_type index() const { return m_Index; }
+
+    friend bool operator==(const IndexIterator& lhs, const IndexIterator& rhs)
+    {
+        return lhs.m_Index == rhs.m_Index && lhs.m_Container == rhs.m_Container;
+    }
+
+    friend bool operator!=(const IndexIterator& lhs, const IndexIterator& rhs) { return !(lhs == rhs); }
+    friend bool operator<(const IndexIterator& lhs, const IndexIterator& rhs) { return lhs.m_Index < rhs.m_Index; }
+    friend bool operator>(const IndexIterator& lhs, const IndexIterator& rhs) { return rhs < lhs; }
+    friend bool operator<=(const IndexIterator& lhs, const IndexIterator& rhs) { return !(rhs < lhs); }
+    friend bool operator>=(const IndexIterator& lhs, const IndexIterator& rhs) { return !(lhs < rhs); }
+
+    reference operator*() const { return (*m_Container)[m_Index]; }
+    pointer operator->() const { return &(*m_Container)[m_Index]; }
+    reference operator[](difference_type offset) const { return (*m_Container)[m_Index + offset]; }
+
+    // prefix version
+    IndexIterator& operator++()
+    {
+        ++m_Index;
+        return *this;
+    }
+
+    IndexIterator& operator--()
+    {
+        --m_Index;
+        return *this;
+    }
+
+    // postfix version
+    IndexIterator operator++(int)
+    {
+        IndexIterator temp(*this);
+        ++m_Index;
+        return temp;
+    }
+
+    IndexIterator operator--(int)
+    {
+        IndexIterator temp(*this);
+        --m_Index;
+        return temp;
+    }
+
+    IndexIterator& operator+=(difference_type offset)
+    {
+        m_Index += offset;
+        return *this;
+    }
+
+    IndexIterator& operator-=(difference_type offset)
+    {
+        m_Index -= offset;
+        return *this;
+    }
+
+    friend IndexIterator operator+(const IndexIterator& lhs, difference_type rhs)
+    {
+        return IndexIterator(lhs.m_Container, lhs.m_Index + rhs);
+    }
+
+    friend IndexIterator operator+(difference_type lhs, const IndexIterator& rhs)
+    {
+        return rhs + lhs;
+    }
+
+    friend IndexIterator operator-(const IndexIterator& lhs, difference_type rhs)
+    {
+        return IndexIterator(lhs.m_Container, lhs.m_Index - rhs);
+    }
+
+    friend difference_type operator-(const IndexIterator& lhs, const IndexIterator& rhs)
+    {
+        return static_cast<difference_type>(lhs.m_Index) - static_cast<difference_type>(rhs.m_Index);
+    }
+};
+
+}
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <iterator>
+
+#include "type_traits.h"
+
 namespace ft
 {
 
@@ -38,4 +43,45 @@ struct iterator_traits<const TType*>
     typedef const TType& reference;
 };
 
+/// Maps std iterator tags (and tags derived from them) onto ft ones, so std iterators
+/// take the same dispatch paths as ours
+template <typename Tag>
+struct to_ft_iterator_tag
+{
+    typedef typename conditional<is_convertible<Tag, std::random_access_iterator_tag>::value, random_access_iterator_tag,
+            typename conditional<is_convertible<Tag, std::bidirectional_iterator_tag>::value, bidirectional_iterator_tag,
+            typename conditional<is_convertible<Tag, std::forward_iterator_tag>::value, forward_iterator_tag,
+            typename conditional<is_convertible<Tag, std::input_iterator_tag>::value, input_iterator_tag,
+            Tag>::type>::type>::type>::type type;
+};
+
+template <typename TIter>
+typename to_ft_iterator_tag<typename iterator_traits<TIter>::iterator_category>::type iterator_category(const TIter&)
+{
+    return typename to_ft_iterator_tag<typename iterator_traits<TIter>::iterator_category>::type();
+}
+
+template <typename TIter>
+typename iterator_traits<TIter>::difference_type distance(TIter first, TIter last, input_iterator_tag)
+{
+    typename iterator_traits<TIter>::difference_type result = 0;
+    for ( ; first != last; ++first)
+    {
+        ++result;
+    }
+    return result;
+}
+
+template <typename TIter>
+typename iterator_traits<TIter>::difference_type distance(TIter first, TIter last, random_access_iterator_tag)
+{
+    return last - first;
+}
+
+template <typename TIter>
+typename iterator_traits<TIter>::difference_type distance(TIter first, TIter last)
+{
+    return ft::distance(first, last, ft::iterator_category(first));
+}
+
 }
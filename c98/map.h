@@ -1,6 +1,7 @@
 #pragma once
 
 #include "rb_tree.h"
+#include "memory.h"
 #include "utility.h"
 #include "type_traits.h"
 #include "functional.h"
@@ -11,7 +12,8 @@ namespace ft
 template <typename Key,                                      // map::key_type
            typename Val,                                       // map::mapped_type
            typename Compare = ft::less<Key>,                     // map::key_compare
-           typename Alloc = std::allocator<pair<const Key, Val> >    // map::allocator_type
+           typename Alloc = std::allocator<pair<const Key, Val> >,   // map::allocator_type
+           bool Threaded = false                                     // keep in-order links for O(1) iteration
 >
 class map
 {
@@ -44,7 +46,7 @@ public:
     };	// Nested function class to compare elements	see value_comp
 
 private:
-    typedef RbTree<key_type, value_type, key_compare, Select1st<value_type>, allocator_type> rb_tree_type;
+    typedef RbTree<key_type, value_type, key_compare, Select1st<value_type>, allocator_type, Threaded> rb_tree_type;
 
 public:
     typedef typename rb_tree_type::iterator iterator; // a bidirectional iterator to value_type	convertible to const_iterator
@@ -115,11 +117,6 @@ public:
 
     iterator insert(iterator position, const value_type& val)
     {
-        iterator found = find(val.first);
-        if (found != end())
-        {
-            return found;
-        }
         return iterator(&m_Tree, m_Tree.add(position, val));
     }
 
@@ -139,7 +136,7 @@ public:
 
     void erase(iterator position)
     {
-        m_Tree.deleteKey(position->first);
+        m_Tree.deleteKey(position);
     }
 
     size_type erase(const key_type& k)
@@ -180,7 +177,7 @@ public:
 
     size_type count(const key_type& k) const
     {
-        return (m_Tree.find(k)) ? 1 : 0;
+        return m_Tree.count(k);
     }
 
     iterator lower_bound(const key_type& k)
@@ -218,6 +215,9 @@ public:
         return allocator_type(m_Tree.get_allocator());
     }
 
+    template <typename K, typename V, typename C, typename A, bool T, typename Predicate>
+    friend typename map<K, V, C, A, T>::size_type erase_if(map<K, V, C, A, T>& c, Predicate pred);
+
     friend bool operator==(const map& lhs, const map& rhs)
     {
         return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
@@ -229,32 +229,43 @@ public:
     }
 };
 
-template <typename Key, typename Val, typename Compare, typename Alloc>
-bool operator!=(const map<Key, Val, Compare, Alloc>& lhs, const map<Key, Val, Compare, Alloc>& rhs)
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+struct is_trivially_relocatable<map<Key, Val, Compare, Alloc, Threaded> >
+    : bool_constant<is_trivially_relocatable<Compare>::value && is_trivially_relocatable<Alloc>::value> /// nodes never point back at the tree
+{};
+
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+bool operator!=(const map<Key, Val, Compare, Alloc, Threaded>& lhs, const map<Key, Val, Compare, Alloc, Threaded>& rhs)
 {
     return !(lhs == rhs);
 }
 
-template <typename Key, typename Val, typename Compare, typename Alloc>
-bool operator<=(const map<Key, Val, Compare, Alloc>& lhs, const map<Key, Val, Compare, Alloc>& rhs)
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+bool operator<=(const map<Key, Val, Compare, Alloc, Threaded>& lhs, const map<Key, Val, Compare, Alloc, Threaded>& rhs)
 {
     return !(rhs < lhs);
 }
 
-template <typename Key, typename Val, typename Compare, typename Alloc>
-bool operator>(const map<Key, Val, Compare, Alloc>& lhs, const map<Key, Val, Compare, Alloc>& rhs)
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+bool operator>(const map<Key, Val, Compare, Alloc, Threaded>& lhs, const map<Key, Val, Compare, Alloc, Threaded>& rhs)
 {
     return rhs < lhs;
 }
 
-template <typename Key, typename Val, typename Compare, typename Alloc>
-bool operator>=(const map<Key, Val, Compare, Alloc>& lhs, const map<Key, Val, Compare, Alloc>& rhs)
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+bool operator>=(const map<Key, Val, Compare, Alloc, Threaded>& lhs, const map<Key, Val, Compare, Alloc, Threaded>& rhs)
 {
     return !(lhs < rhs);
 }
 
-template <typename Key, typename Val, typename Compare, typename Alloc>
-void swap(map<Key, Val, Compare, Alloc>& a, map<Key, Val, Compare, Alloc>& b)
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded, typename Predicate>
+typename map<Key, Val, Compare, Alloc, Threaded>::size_type erase_if(map<Key, Val, Compare, Alloc, Threaded>& c, Predicate pred)
+{
+    return c.m_Tree.erase_if(pred);
+}
+
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+void swap(map<Key, Val, Compare, Alloc, Threaded>& a, map<Key, Val, Compare, Alloc, Threaded>& b)
 {
     a.swap(b);
 }
@@ -0,0 +1,365 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "type_traits.h"
+
+#if defined(_LIBCPP_VERSION) || (defined(_GLIBCXX_USE_CXX11_ABI) && _GLIBCXX_USE_CXX11_ABI == 0)
+#include <string>
+#define FT_RELOCATABLE_STRING 1 /// libc++ and the COW libstdc++ string keep no pointer into themselves
+#endif
+
+namespace ft
+{
+
+/// Objects that can be moved to new storage by memcpy, the source then being dropped
+/// without running its destructor. Anything trivially copyable qualifies; other types
+/// opt in by specializing, which is only correct if they hold no pointer into themselves.
+template <typename TType>
+struct is_trivially_relocatable : is_trivially_copyable<TType>
+{};
+
+template <typename TType>
+struct is_trivially_relocatable<std::allocator<TType> > : true_type
+{};
+
+#ifdef FT_RELOCATABLE_STRING
+template <typename TChar, typename TTraits, typename TAlloc>
+struct is_trivially_relocatable<std::basic_string<TChar, TTraits, TAlloc> > : is_trivially_relocatable<TAlloc>
+{};
+#endif
+
+/// Raw storage helpers shared by the contiguous containers.
+/// Trivially copyable types go through memcpy/memmove, the rest through the allocator.
+/// The copy and fill helpers destroy what they built before letting an exception out.
+
+/// construct/destroy half of an allocator, for containers that own their storage
+template <typename TType>
+struct placement_construct
+{
+    void construct(TType* p, const TType& val) { new (static_cast<void*>(p)) TType(val); }
+    void destroy(TType* p) { p->~TType(); }
+};
+
+template <typename TAlloc, typename TType>
+void uninitialized_copy_n(TAlloc&, TType* destination, const TType* source, std::size_t count, true_type)
+{
+    if (count != 0)
+    {
+        std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(TType));
+    }
+}
+
+template <typename TAlloc, typename TType>
+void uninitialized_copy_n(TAlloc& alloc, TType* destination, const TType* source, std::size_t count, false_type)
+{
+    std::size_t i = 0;
+    try
+    {
+        for (; i < count; ++i)
+        {
+            alloc.construct(destination + i, source[i]);
+        }
+    }
+    catch (...)
+    {
+        while (i > 0)
+        {
+            alloc.destroy(destination + --i);
+        }
+        throw;
+    }
+}
+
+template <typename TAlloc, typename TType>
+void uninitialized_copy_n(TAlloc& alloc, TType* destination, const TType* source, std::size_t count)
+{
+    uninitialized_copy_n(alloc, destination, source, count, typename is_trivially_copyable<TType>::type());
+}
+
+template <typename TAlloc, typename TType>
+void uninitialized_fill_n(TAlloc& alloc, TType* destination, std::size_t count, const TType& value)
+{
+    std::size_t i = 0;
+    try
+    {
+        for (; i < count; ++i)
+        {
+            alloc.construct(destination + i, value);
+        }
+    }
+    catch (...)
+    {
+        while (i > 0)
+        {
+            alloc.destroy(destination + --i);
+        }
+        throw;
+    }
+}
+
+template <typename TAlloc, typename TType>
+void uninitialized_relocate_n(TAlloc&, TType* destination, TType* source, std::size_t count, true_type)
+{
+    if (count != 0)
+    {
+        std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(TType));
+    }
+}
+
+template <typename TAlloc, typename TType>
+void uninitialized_relocate_n(TAlloc& alloc, TType* destination, TType* source, std::size_t count, false_type)
+{
+    if (destination < source)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            alloc.construct(destination + i, source[i]);
+            alloc.destroy(source + i);
+        }
+    }
+    else
+    {
+        for (std::size_t i = count; i > 0; --i)
+        {
+            alloc.construct(destination + i - 1, source[i - 1]);
+            alloc.destroy(source + i - 1);
+        }
+    }
+}
+
+/// Moves count objects from source to destination, ranges may overlap.
+/// Source objects are dead afterwards.
+template <typename TAlloc, typename TType>
+void uninitialized_relocate_n(TAlloc& alloc, TType* destination, TType* source, std::size_t count)
+{
+    uninitialized_relocate_n(alloc, destination, source, count, bool_constant<is_trivially_relocatable<TType>::value>());
+}
+
+template <typename TAlloc, typename TType>
+void destroy_n(TAlloc&, TType*, std::size_t, true_type)
+{}
+
+template <typename TAlloc, typename TType>
+void destroy_n(TAlloc& alloc, TType* first, std::size_t count, false_type)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        alloc.destroy(first + i);
+    }
+}
+
+template <typename TAlloc, typename TType>
+void destroy_n(TAlloc& alloc, TType* first, std::size_t count)
+{
+    destroy_n(alloc, first, count, typename is_trivially_copyable<TType>::type());
+}
+
+/// Copy-constructs count elements from a forward range
+template <typename TAlloc, typename TType, typename ForwardIterator>
+void uninitialized_copy_range(TAlloc& alloc, TType* destination, ForwardIterator first, std::size_t count)
+{
+    std::size_t i = 0;
+    try
+    {
+        for (; i < count; ++i, ++first)
+        {
+            alloc.construct(destination + i, *first);
+        }
+    }
+    catch (...)
+    {
+        destroy_n(alloc, destination, i);
+        throw;
+    }
+}
+
+template <typename TAlloc, typename TType>
+void shift_n(TAlloc& alloc, TType* data, std::size_t&, std::size_t destination, std::size_t source, std::size_t count, true_type)
+{
+    uninitialized_relocate_n(alloc, data + destination, data + source, count);
+}
+
+template <typename TAlloc, typename TType>
+void shift_n(TAlloc& alloc, TType* data, std::size_t& size, std::size_t destination, std::size_t source, std::size_t count, false_type)
+{
+    std::size_t moved = 0;
+    try
+    {
+        for (; moved < count; ++moved)
+        {
+            std::size_t i = destination < source ? moved : count - 1 - moved;
+            alloc.construct(data + destination + i, data[source + i]);
+            alloc.destroy(data + source + i);
+        }
+    }
+    catch (...)
+    {
+        if (destination < source)
+        {
+            destroy_n(alloc, data + source + moved, count - moved);
+            size = destination + moved;
+        }
+        else
+        {
+            destroy_n(alloc, data + destination + count - moved, moved);
+            size = source + count - moved;
+        }
+        throw;
+    }
+}
+
+/// Relocates count elements of a buffer holding size of them, ranges may overlap.
+/// If a copy throws, size is cut to the intact prefix and the stranded elements are destroyed.
+template <typename TAlloc, typename TType>
+void shift_n(TAlloc& alloc, TType* data, std::size_t& size, std::size_t destination, std::size_t source, std::size_t count)
+{
+    shift_n(alloc, data, size, destination, source, count, bool_constant<is_trivially_relocatable<TType>::value>());
+}
+
+template <typename TAlloc, typename TType>
+void transfer_n(TAlloc& alloc, TType* destination, TType* source, std::size_t count, true_type)
+{
+    uninitialized_relocate_n(alloc, destination, source, count);
+}
+
+template <typename TAlloc, typename TType>
+void transfer_n(TAlloc& alloc, TType* destination, TType* source, std::size_t count, false_type)
+{
+    uninitialized_copy_n(alloc, destination, source, count);
+    destroy_n(alloc, source, count);
+}
+
+/// Moves count elements to separate storage. The sources die only once every copy exists,
+/// so a throwing copy leaves them as they were.
+template <typename TAlloc, typename TType>
+void transfer_n(TAlloc& alloc, TType* destination, TType* source, std::size_t count)
+{
+    transfer_n(alloc, destination, source, count, bool_constant<is_trivially_relocatable<TType>::value>());
+}
+
+/// Swaps the elements of two separate buffers: the common prefix by assignment, then the longer
+/// one's extra elements move over. A throwing copy leaves both buffers valid with their sizes.
+template <typename TAlloc, typename TType>
+void swap_buffers(TAlloc& alloc, TType* left, std::size_t& left_size, TType* right, std::size_t& right_size)
+{
+    bool left_longer = left_size > right_size;
+    TType* longer = left_longer ? left : right;
+    TType* shorter = left_longer ? right : left;
+    std::size_t& longer_size = left_longer ? left_size : right_size;
+    std::size_t& shorter_size = left_longer ? right_size : left_size;
+    std::size_t common = shorter_size;
+    for (std::size_t i = 0; i < common; ++i)
+    {
+        TType tmp(left[i]);
+        left[i] = right[i];
+        right[i] = tmp;
+    }
+    transfer_n(alloc, shorter + common, longer + common, longer_size - common);
+    shorter_size = longer_size;
+    longer_size = common;
+}
+
+/// Gap builders for insert_gap_n
+template <typename TAlloc, typename TType>
+struct fill_builder
+{
+    TAlloc& m_Allocator;
+    const TType& m_Value;
+
+    fill_builder(TAlloc& alloc, const TType& val) : m_Allocator(alloc), m_Value(val) {}
+    void operator()(TType* destination, std::size_t count) const
+    {
+        uninitialized_fill_n(m_Allocator, destination, count, m_Value);
+    }
+};
+
+template <typename TAlloc, typename ForwardIterator>
+struct copy_builder
+{
+    TAlloc& m_Allocator;
+    ForwardIterator m_First;
+
+    copy_builder(TAlloc& alloc, ForwardIterator first) : m_Allocator(alloc), m_First(first) {}
+    template <typename TType>
+    void operator()(TType* destination, std::size_t count) const
+    {
+        uninitialized_copy_range(m_Allocator, destination, m_First, count);
+    }
+};
+
+/// Inserts count elements at position of a buffer that has room for them: shifts the tail up,
+/// then build_gap constructs the gap. If building throws, the tail moves back down, so the
+/// buffer is as before (cut to its intact prefix only if moving back throws as well).
+template <typename TAlloc, typename TType, typename TBuildGap>
+void insert_gap_n(TAlloc& alloc, TType* data, std::size_t& size, std::size_t position, std::size_t count, const TBuildGap& build_gap)
+{
+    std::size_t tail = size - position;
+    shift_n(alloc, data, size, position + count, position, tail);
+    try
+    {
+        build_gap(data + position, count);
+    }
+    catch (...)
+    {
+        shift_n(alloc, data, size, position, position + count, tail);
+        throw;
+    }
+    size += count;
+}
+
+/// Owns freshly allocated storage while it is filled front to back.
+/// Unless released, unwinding destroys the built prefix and frees the storage,
+/// so a throwing copy during growth leaves the old buffer untouched.
+template <typename TAlloc>
+class storage_guard
+{
+public:
+    typedef typename TAlloc::pointer pointer;
+
+private:
+    TAlloc& m_Allocator;
+    std::size_t m_Capacity;
+    pointer m_Data;
+    std::size_t m_Built;
+
+    storage_guard(const storage_guard&);
+    storage_guard& operator=(const storage_guard&);
+
+public:
+    storage_guard(TAlloc& alloc, std::size_t capacity)
+        : m_Allocator(alloc)
+        , m_Capacity(capacity)
+        , m_Data(alloc.allocate(capacity))
+        , m_Built(0)
+    {}
+
+    ~storage_guard()
+    {
+        if (m_Data != NULL)
+        {
+            destroy_n(m_Allocator, m_Data, m_Built);
+            m_Allocator.deallocate(m_Data, m_Capacity);
+        }
+    }
+
+    pointer get() const { return m_Data; }
+    std::size_t capacity() const { return m_Capacity; }
+
+    void built(std::size_t count) /// count more elements were constructed after the previous ones
+    {
+        m_Built += count;
+    }
+
+    pointer release()
+    {
+        pointer data = m_Data;
+        m_Data = NULL;
+        return data;
+    }
+};
+
+}
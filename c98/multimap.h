@@ -0,0 +1,259 @@
+#pragma once
+
+#include "rb_tree.h"
+#include "memory.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "functional.h"
+
+namespace ft
+{
+
+template <typename Key,
+          typename Val,
+          typename Compare = ft::less<Key>,
+          typename Alloc = std::allocator<pair<const Key, Val> >,
+          bool Threaded = false
+>
+class multimap
+{
+public:
+    typedef Key key_type;
+    typedef Val mapped_type;
+    typedef pair<const key_type, mapped_type> value_type;
+    typedef Compare key_compare;
+    typedef Alloc allocator_type;
+    typedef typename allocator_type::reference reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer pointer;
+    typedef typename allocator_type::const_pointer const_pointer;
+
+    class value_compare
+    {
+    protected:
+        Compare m_Comp;
+        explicit value_compare(Compare c) : m_Comp(c) {}
+
+        friend class multimap;
+    public:
+        typedef bool result_type;
+        typedef value_type first_argument_type;
+        typedef value_type second_argument_type;
+
+    public:
+        bool operator()(const value_type& x, const value_type& y) const
+        {
+            return m_Comp(x.first, y.first);
+        }
+    };
+
+private:
+    typedef RbTree<key_type, value_type, key_compare, Select1st<value_type>, allocator_type, Threaded> rb_tree_type;
+
+public:
+    typedef typename rb_tree_type::iterator iterator;
+    typedef typename rb_tree_type::const_iterator const_iterator;
+    typedef typename rb_tree_type::reverse_iterator reverse_iterator;
+    typedef typename rb_tree_type::const_reverse_iterator const_reverse_iterator;
+    typedef typename rb_tree_type::difference_type difference_type;
+    typedef typename rb_tree_type::size_type size_type;
+
+private:
+    rb_tree_type m_Tree;
+
+public:
+    explicit multimap(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : m_Tree(comp, alloc) {}
+
+    template <class InputIterator>
+    multimap(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+        : m_Tree(comp, alloc)
+    {
+        insert(first, last);
+    }
+
+    multimap(const multimap& x) : m_Tree(x.m_Tree) {}
+
+    ~multimap() {}
+
+    multimap& operator=(const multimap& x)
+    {
+        if (&x != this)
+        {
+            m_Tree = x.m_Tree;
+        }
+        return *this;
+    }
+
+    iterator begin() { return iterator(&m_Tree, m_Tree.get_min()); }
+    const_iterator begin() const { return const_iterator(&m_Tree, m_Tree.get_min()); }
+    iterator end() { return iterator(&m_Tree, NULL); }
+    const_iterator end() const { return const_iterator(&m_Tree, NULL); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    bool empty() const { return m_Tree.empty(); }
+    size_type size() const { return m_Tree.size(); }
+    size_type max_size() const { return m_Tree.max_size(); }
+
+    iterator insert(const value_type& val) /// placed after the keys equal to val
+    {
+        return iterator(&m_Tree, m_Tree.add_equal(val));
+    }
+
+    iterator insert(iterator position, const value_type& val) /// placed right before position when the order allows it
+    {
+        return iterator(&m_Tree, m_Tree.add_equal(position, val));
+    }
+
+    template <typename InputIterator>
+    typename enable_if<is_same<typename InputIterator::value_type, value_type>::value>::type
+    insert(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+        {
+            insert(end(), *first);
+        }
+    }
+
+    void erase(iterator position) /// O(log n), up to O(log^2 n) when many keys equal its own
+    {
+        m_Tree.deleteKey(position);
+    }
+
+    size_type erase(const key_type& k)
+    {
+        pair<iterator, iterator> range = equal_range(k);
+        size_type erased = 0;
+        while (range.first != range.second)
+        {
+            erase(range.first++);
+            ++erased;
+        }
+        return erased;
+    }
+
+    void erase(iterator first, iterator last)
+    {
+        while (first != last)
+        {
+            erase(first++);
+        }
+    }
+
+    void swap(multimap& x)
+    {
+        m_Tree.swap(x.m_Tree);
+    }
+
+    void clear()
+    {
+        m_Tree.clear();
+    }
+
+    key_compare key_comp() const { return m_Tree.key_comp(); }
+    value_compare value_comp() const { return value_compare(m_Tree.key_comp()); }
+
+    iterator find(const key_type& k)
+    {
+        return iterator(&m_Tree, m_Tree.find(k));
+    }
+
+    const_iterator find(const key_type& k) const
+    {
+        return const_iterator(&m_Tree, m_Tree.find(k));
+    }
+
+    size_type count(const key_type& k) const /// O(log n + count)
+    {
+        return m_Tree.count(k);
+    }
+
+    iterator lower_bound(const key_type& k)
+    {
+        return iterator(&m_Tree, m_Tree.lower_bound(k));
+    }
+
+    const_iterator lower_bound(const key_type& k) const
+    {
+        return const_iterator(&m_Tree, m_Tree.lower_bound(k));
+    }
+
+    iterator upper_bound(const key_type& k)
+    {
+        return iterator(&m_Tree, m_Tree.upper_bound(k));
+    }
+
+    const_iterator upper_bound(const key_type& k) const
+    {
+        return const_iterator(&m_Tree, m_Tree.upper_bound(k));
+    }
+
+    pair<iterator, iterator> equal_range(const key_type& k)
+    {
+        return pair<iterator, iterator>(lower_bound(k), upper_bound(k));
+    }
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+    {
+        return pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k));
+    }
+
+    template <typename K, typename V, typename C, typename A, bool T, typename Predicate>
+    friend typename multimap<K, V, C, A, T>::size_type erase_if(multimap<K, V, C, A, T>& c, Predicate pred);
+
+    friend bool operator==(const multimap& lhs, const multimap& rhs)
+    {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend bool operator<(const multimap& lhs, const multimap& rhs)
+    {
+        return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+};
+
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+struct is_trivially_relocatable<multimap<Key, Val, Compare, Alloc, Threaded> >
+    : bool_constant<is_trivially_relocatable<Compare>::value && is_trivially_relocatable<Alloc>::value>
+{};
+
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+bool operator!=(const multimap<Key, Val, Compare, Alloc, Threaded>& lhs, const multimap<Key, Val, Compare, Alloc, Threaded>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+bool operator<=(const multimap<Key, Val, Compare, Alloc, Threaded>& lhs, const multimap<Key, Val, Compare, Alloc, Threaded>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+bool operator>(const multimap<Key, Val, Compare, Alloc, Threaded>& lhs, const multimap<Key, Val, Compare, Alloc, Threaded>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+bool operator>=(const multimap<Key, Val, Compare, Alloc, Threaded>& lhs, const multimap<Key, Val, Compare, Alloc, Threaded>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded, typename Predicate>
+typename multimap<Key, Val, Compare, Alloc, Threaded>::size_type erase_if(multimap<Key, Val, Compare, Alloc, Threaded>& c, Predicate pred)
+{
+    return c.m_Tree.erase_if(pred);
+}
+
+template <typename Key, typename Val, typename Compare, typename Alloc, bool Threaded>
+void swap(multimap<Key, Val, Compare, Alloc, Threaded>& a, multimap<Key, Val, Compare, Alloc, Threaded>& b)
+{
+    a.swap(b);
+}
+
+}
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <memory>
+
+#include "rb_tree.h"
+#include "memory.h"
+#include "utility.h"
+#include "functional.h"
+
+namespace ft
+{
+
+template <class T,
+          class Compare = ft::less<T>,
+          class Alloc = std::allocator<T>,
+          bool Threaded = false
+>
+class multiset
+{
+public:
+    typedef T key_type;
+    typedef T value_type;
+    typedef Compare key_compare;
+    typedef Compare value_compare;
+    typedef Alloc allocator_type;
+
+    typedef typename allocator_type::reference reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer pointer;
+    typedef typename allocator_type::const_pointer const_pointer;
+
+private:
+    typedef RbTree<key_type, value_type, key_compare, Identity<value_type>, allocator_type, Threaded> rb_tree_type;
+
+public:
+    typedef typename rb_tree_type::iterator iterator;
+    typedef typename rb_tree_type::const_iterator const_iterator;
+    typedef typename rb_tree_type::reverse_iterator reverse_iterator;
+    typedef typename rb_tree_type::const_reverse_iterator const_reverse_iterator;
+    typedef typename rb_tree_type::difference_type difference_type;
+    typedef typename rb_tree_type::size_type size_type;
+
+private:
+    rb_tree_type m_Tree;
+
+public:
+    explicit multiset(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : m_Tree(comp, alloc) {}
+
+    template <class InputIterator>
+    multiset(InputIterator first, InputIterator last,
+             const key_compare& comp = key_compare(),
+             const allocator_type& alloc = allocator_type()) : m_Tree(comp, alloc)
+    {
+        insert(first, last);
+    }
+
+    multiset(const multiset& x) : m_Tree(x.m_Tree) {}
+
+    multiset &operator=(const multiset& x)
+    {
+        if (&x != this)
+        {
+            m_Tree = x.m_Tree;
+        }
+        return *this;
+    }
+
+    ~multiset() {}
+
+    iterator begin() { return iterator(&m_Tree, m_Tree.get_min()); }
+    const_iterator begin() const { return const_iterator(&m_Tree, m_Tree.get_min()); }
+    iterator end() { return iterator(&m_Tree, NULL); }
+    const_iterator end() const { return const_iterator(&m_Tree, NULL); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    bool empty() const { return m_Tree.empty(); }
+    size_type size() const { return m_Tree.size(); }
+    size_type max_size() const { return m_Tree.max_size(); }
+
+    iterator insert(const value_type& val) /// placed after the values equal to val
+    {
+        return iterator(&m_Tree, m_Tree.add_equal(val));
+    }
+
+    iterator insert(iterator position, const value_type& val) /// placed right before position when the order allows it
+    {
+        return iterator(&m_Tree, m_Tree.add_equal(position, val));
+    }
+
+    template <class InputIterator>
+    typename enable_if<is_same<typename InputIterator::value_type, value_type>::value>::type
+    insert(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+        {
+            insert(end(), *first);
+        }
+    }
+
+    void erase(iterator position) /// O(log n), up to O(log^2 n) when many keys equal its own
+    {
+        m_Tree.deleteKey(position);
+    }
+
+    size_type erase(const value_type& val)
+    {
+        pair<iterator, iterator> range = equal_range(val);
+        size_type erased = 0;
+        while (range.first != range.second)
+        {
+            erase(range.first++);
+            ++erased;
+        }
+        return erased;
+    }
+
+    void erase(iterator first, iterator last)
+    {
+        while (first != last)
+        {
+            erase(first++);
+        }
+    }
+
+    void swap(multiset& x)
+    {
+        m_Tree.swap(x.m_Tree);
+    }
+
+    void clear()
+    {
+        m_Tree.clear();
+    }
+
+    key_compare key_comp() const { return m_Tree.key_comp(); }
+    value_compare value_comp() const { return m_Tree.key_comp(); }
+
+    iterator find(const value_type& val) const
+    {
+        return iterator(&m_Tree, m_Tree.find(val));
+    }
+
+    size_type count(const value_type& val) const /// O(log n + count)
+    {
+        return m_Tree.count(val);
+    }
+
+    iterator lower_bound(const value_type& val) const
+    {
+        return iterator(&m_Tree, m_Tree.lower_bound(val));
+    }
+
+    iterator upper_bound(const value_type& val) const
+    {
+        return iterator(&m_Tree, m_Tree.upper_bound(val));
+    }
+
+    pair<iterator, iterator> equal_range(const value_type& val) const
+    {
+        return pair<iterator, iterator>(lower_bound(val), upper_bound(val));
+    }
+
+    template <class U, class C, class A, bool Th, class Predicate>
+    friend typename multiset<U, C, A, Th>::size_type erase_if(multiset<U, C, A, Th>& c, Predicate pred);
+
+    friend bool operator==(const multiset& lhs, const multiset& rhs)
+    {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend bool operator<(const multiset& lhs, const multiset& rhs)
+    {
+        return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+};
+
+template <typename T, typename Compare, typename Alloc, bool Threaded>
+struct is_trivially_relocatable<multiset<T, Compare, Alloc, Threaded> >
+    : bool_constant<is_trivially_relocatable<Compare>::value && is_trivially_relocatable<Alloc>::value>
+{};
+
+template <class T, class Compare, class Alloc, bool Threaded>
+bool operator!=(const multiset<T, Compare, Alloc, Threaded> &lhs, const multiset<T, Compare, Alloc, Threaded> &rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class T, class Compare, class Alloc, bool Threaded>
+bool operator>=(const multiset<T, Compare, Alloc, Threaded> &lhs, const multiset<T, Compare, Alloc, Threaded> &rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class T, class Compare, class Alloc, bool Threaded>
+bool operator>(const multiset<T, Compare, Alloc, Threaded> &lhs, const multiset<T, Compare, Alloc, Threaded> &rhs)
+{
+    return rhs < lhs;
+}
+
+template <class T, class Compare, class Alloc, bool Threaded>
+bool operator<=(const multiset<T, Compare, Alloc, Threaded> &lhs, const multiset<T, Compare, Alloc, Threaded> &rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class T, class Compare, class Alloc, bool Threaded, class Predicate>
+typename multiset<T, Compare, Alloc, Threaded>::size_type erase_if(multiset<T, Compare, Alloc, Threaded>& c, Predicate pred)
+{
+    return c.m_Tree.erase_if(pred);
+}
+
+template <class T, class Compare, class Alloc, bool Threaded>
+void swap(multiset<T, Compare, Alloc, Threaded> &a, multiset<T, Compare, Alloc, Threaded> &b)
+{
+    a.swap(b);
+}
+
+}
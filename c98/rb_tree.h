@@ -7,6 +7,7 @@
 
 #include "algorithm.h"
 #include "utility.h"
+#include "vector.h"
 
 namespace ft
 {
@@ -17,9 +18,24 @@ enum RbTreeColor
     BLACK,
 };
 
-template <typename Val>
-class RbTreeNode
+template <typename Node, bool Threaded>
+struct RbTreeThread
+{};
+
+template <typename Node>
+struct RbTreeThread<Node, true> /// in-order neighbours, kept only in threaded mode
+{
+    Node* m_Prev;
+    Node* m_Next;
+
+    RbTreeThread() : m_Prev(NULL), m_Next(NULL) {}
+};
+
+template <typename Val, bool Threaded = false>
+class RbTreeNode : public RbTreeThread<RbTreeNode<Val, Threaded>, Threaded>
 {
+    typedef RbTreeThread<RbTreeNode<Val, Threaded>, Threaded> thread_type;
+
 public:
     typedef RbTreeNode* node_ptr;
     typedef const RbTreeNode* const_node_ptr;
@@ -34,7 +50,8 @@ public:
 
 public:
     RbTreeNode(Val value)
-        : m_Color(RED)
+        : thread_type()
+        , m_Color(RED)
         , m_Parent(NULL)
         , m_Left(NULL)
         , m_Right(NULL)
@@ -43,7 +60,8 @@ public:
     {}
 
     RbTreeNode(const RbTreeNode& other)
-        : m_Color(other.m_Color)
+        : thread_type(other)
+        , m_Color(other.m_Color)
         , m_Parent(other.m_Parent)
         , m_Left(other.m_Left)
         , m_Right(other.m_Right)
@@ -55,6 +73,7 @@ public:
     {
         if (this != &other)
         {
+            thread_type::operator=(other);
             m_Color = other.m_Color;
             m_Parent = other.m_Parent;
             m_Left = other.m_Left;
@@ -68,16 +87,74 @@ public:
     ~RbTreeNode() {}
 };
 
-template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc>
+template <bool Threaded>
+struct RbTreeStep /// in-order step through parent links, O(log n) worst case
+{
+    template <typename NodePtr>
+    static NodePtr next(NodePtr node)
+    {
+        if (node->m_Right)
+        {
+            node = node->m_Right;
+            while (node->m_Left)
+            {
+                node = node->m_Left;
+            }
+            return node;
+        }
+        while (node->m_Parent && !node->m_IsLeft)
+        {
+            node = node->m_Parent;
+        }
+        return node->m_Parent;
+    }
+
+    template <typename NodePtr>
+    static NodePtr prev(NodePtr node)
+    {
+        if (node->m_Left)
+        {
+            node = node->m_Left;
+            while (node->m_Right)
+            {
+                node = node->m_Right;
+            }
+            return node;
+        }
+        while (node->m_Parent && node->m_IsLeft)
+        {
+            node = node->m_Parent;
+        }
+        return node->m_Parent;
+    }
+};
+
+template <>
+struct RbTreeStep<true> /// in-order step through thread links, O(1) worst case
+{
+    template <typename NodePtr>
+    static NodePtr next(NodePtr node)
+    {
+        return node->m_Next;
+    }
+
+    template <typename NodePtr>
+    static NodePtr prev(NodePtr node)
+    {
+        return node->m_Prev;
+    }
+};
+
+template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc, bool Threaded>
 class RbTree;
 
-template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc>
+template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc, bool Threaded>
 class RbTreeIterator
 {
-    typedef RbTree<Key, Val, Compare, KeyExtract, Alloc> tree_type;
+    typedef RbTree<Key, Val, Compare, KeyExtract, Alloc, Threaded> tree_type;
 public:
     typedef bidirectional_iterator_tag iterator_category;
-    typedef RbTreeNode<Val> node_type;
+    typedef RbTreeNode<Val, Threaded> node_type;
     typedef typename node_type::node_ptr node_ptr;
 
     typedef Val value_type;
@@ -108,21 +185,9 @@ public:
         {
             m_Node = m_TreePtr->get_min();
         }
-        else if (m_Node->m_Right)
-        {
-            m_Node = m_Node->m_Right;
-            while (m_Node && m_Node->m_Left)
-            {
-                m_Node = m_Node->m_Left;
-            }
-        }
         else
         {
-            while (m_Node && m_Node->m_Parent && !m_Node->m_IsLeft)
-            {
-                m_Node = m_Node->m_Parent;
-            }
-            m_Node = m_Node->m_Parent;
+            m_Node = RbTreeStep<Threaded>::next(m_Node);
         }
         return *this;
     }
@@ -140,21 +205,9 @@ public:
         {
             m_Node = m_TreePtr->get_max();
         }
-        else if (m_Node->m_Left)
-        {
-            m_Node = m_Node->m_Left;
-            while (m_Node && m_Node->m_Right)
-            {
-                m_Node = m_Node->m_Right;
-            }
-        }
         else
         {
-            while (m_Node && m_Node->m_Parent && m_Node->m_IsLeft)
-            {
-                m_Node = m_Node->m_Parent;
-            }
-            m_Node = m_Node->m_Parent;
+            m_Node = RbTreeStep<Threaded>::prev(m_Node);
         }
         return *this;
     }
@@ -190,13 +243,13 @@ public:
     }
 };
 
-template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc>
+template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc, bool Threaded>
 class RbTreeConstIterator
 {
-    typedef RbTree<Key, Val, Compare, KeyExtract, Alloc> tree_type;
+    typedef RbTree<Key, Val, Compare, KeyExtract, Alloc, Threaded> tree_type;
 public:
     typedef bidirectional_iterator_tag iterator_category;
-    typedef RbTreeNode<Val> node_type;
+    typedef RbTreeNode<Val, Threaded> node_type;
     typedef typename node_type::const_node_ptr node_ptr;
 
     typedef Val value_type;
@@ -204,7 +257,7 @@ public:
     typedef const value_type* pointer;
     typedef ptrdiff_t difference_type;
 
-    typedef RbTreeIterator<Key, Val, Compare, KeyExtract, Alloc> iterator;
+    typedef RbTreeIterator<Key, Val, Compare, KeyExtract, Alloc, Threaded> iterator;
 
 private:
     node_ptr m_Node;
@@ -229,21 +282,9 @@ public:
         {
             m_Node = m_TreePtr->get_min();
         }
-        else if (m_Node->m_Right)
-        {
-            m_Node = m_Node->m_Right;
-            while (m_Node && m_Node->m_Left)
-            {
-                m_Node = m_Node->m_Left;
-            }
-        }
         else
         {
-            while (m_Node && m_Node->m_Parent && !m_Node->m_IsLeft)
-            {
-                m_Node = m_Node->m_Parent;
-            }
-            m_Node = m_Node->m_Parent;
+            m_Node = RbTreeStep<Threaded>::next(m_Node);
         }
         return *this;
     }
@@ -261,21 +302,9 @@ public:
         {
             m_Node = m_TreePtr->get_max();
         }
-        else if (m_Node->m_Left)
-        {
-            m_Node = m_Node->m_Left;
-            while (m_Node && m_Node->m_Right)
-            {
-                m_Node = m_Node->m_Right;
-            }
-        }
         else
         {
-            while (m_Node && m_Node->m_Parent && m_Node->m_IsLeft)
-            {
-                m_Node = m_Node->m_Parent;
-            }
-            m_Node = m_Node->m_Parent;
+            m_Node = RbTreeStep<Threaded>::prev(m_Node);
         }
         return *this;
     }
@@ -306,37 +335,37 @@ public:
     }
 };
 
-template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc>
+template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc, bool Threaded>
 inline bool operator==(
-    const RbTreeIterator<Key, Val, Compare, KeyExtract, Alloc>& lhs, 
-    const RbTreeConstIterator<Key, Val, Compare, KeyExtract, Alloc>& rhs)
+    const RbTreeIterator<Key, Val, Compare, KeyExtract, Alloc, Threaded>& lhs, 
+    const RbTreeConstIterator<Key, Val, Compare, KeyExtract, Alloc, Threaded>& rhs)
 {
     return lhs.base() == rhs.base();
 }
 
-template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc>
+template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc, bool Threaded>
 inline bool operator!=(
-    const RbTreeIterator<Key, Val, Compare, KeyExtract, Alloc>& lhs, 
-    const RbTreeConstIterator<Key, Val, Compare, KeyExtract, Alloc>& rhs)
+    const RbTreeIterator<Key, Val, Compare, KeyExtract, Alloc, Threaded>& lhs, 
+    const RbTreeConstIterator<Key, Val, Compare, KeyExtract, Alloc, Threaded>& rhs)
 {
     return lhs.base() != rhs.base();
 }
 
-template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc = std::allocator<Val> >
+template <typename Key, typename Val, typename Compare, typename KeyExtract, typename Alloc = std::allocator<Val>, bool Threaded = false>
 class RbTree
 {
 private:
     typedef Compare key_compare_type;
     typedef Alloc allocator_value_type;
 
-    typedef RbTreeNode<Val> node_type;
+    typedef RbTreeNode<Val, Threaded> node_type;
     typedef typename allocator_value_type::template rebind<node_type>::other node_allocator;
 
 public:
     typedef ptrdiff_t difference_type;
     typedef size_t size_type;
-    typedef RbTreeIterator<Key, Val, Compare, KeyExtract, Alloc> iterator;
-    typedef RbTreeConstIterator<Key, Val, Compare, KeyExtract, Alloc> const_iterator;
+    typedef RbTreeIterator<Key, Val, Compare, KeyExtract, Alloc, Threaded> iterator;
+    typedef RbTreeConstIterator<Key, Val, Compare, KeyExtract, Alloc, Threaded> const_iterator;
     typedef ReverseIterator<iterator> reverse_iterator;
     typedef ReverseIterator<const_iterator> const_reverse_iterator;
 
@@ -347,6 +376,8 @@ private:
     key_compare_type m_Comparator;
     node_allocator m_Allocator;
 
+    static const size_type s_RebuildFraction = 8;
+
 public:
     RbTree(const key_compare_type& comp, const allocator_value_type& alloc = allocator_value_type())
         : m_Root(NULL)
@@ -366,6 +397,7 @@ public:
             m_Root = m_Allocator.allocate(1);
             m_Allocator.construct(m_Root, *other.m_Root);
             copyTree(m_Root, other.m_Root);
+            rethread(bool_constant<Threaded>());
         }
     }
 
@@ -373,11 +405,13 @@ public:
     {
         if (this != &other)
         {
+            deleteTree(m_Root);
             if (other.m_Root != NULL)
             {
                 m_Root = m_Allocator.allocate(1);
                 m_Allocator.construct(m_Root, *other.m_Root);
                 copyTree(m_Root, other.m_Root);
+                rethread(bool_constant<Threaded>());
             }
             else
             {
@@ -393,12 +427,6 @@ public:
     ~RbTree()
     {
         deleteTree(m_Root);
-        if (m_Root != NULL)
-        {
-            m_Allocator.deallocate(m_Root, m_Size);
-            m_Root = NULL;
-            m_Size = 0;
-        }
     }
 
     void swap(RbTree &x)
@@ -451,27 +479,44 @@ public:
         return m_Size == 0;
     }
 
-    typename node_type::node_ptr find(const Key& k) const
+    typename node_type::node_ptr find(const Key& k) const /// first of the equal keys
     {
-        return find(m_Root, k);
+        typename node_type::node_ptr node = lower_bound(k);
+        if (node && !m_Comparator(k, KeyExtract()(node->m_Value)))
+        {
+            return node;
+        }
+        return NULL;
     }
 
-    typename node_type::node_ptr find(typename node_type::node_ptr node, const Key& k) const
+    typename node_type::node_ptr lower_bound(const Key& k) const
     {
+        typename node_type::node_ptr node = m_Root;
+        typename node_type::node_ptr bound = NULL;
         while (node)
         {
-            if (!m_Comparator(KeyExtract()(node->m_Value), k) && !m_Comparator(k, KeyExtract()(node->m_Value)))
+            if (!m_Comparator(KeyExtract()(node->m_Value), k))
             {
-                iterator it(this, node);
-                iterator next(this, node);
-                for (--next; next.base() && (!m_Comparator(KeyExtract()(*next), k) && !m_Comparator(k, KeyExtract()(*next))); --next)
-                {
-                    --it;
-                }
-                return it.base();
+                bound = node;
+                node = node->m_Left;
             }
-            if (!m_Comparator(KeyExtract()(node->m_Value), k))
+            else
+            {
+                node = node->m_Right;
+            }
+        }
+        return bound;
+    }
+
+    typename node_type::node_ptr upper_bound(const Key& k) const
+    {
+        typename node_type::node_ptr node = m_Root;
+        typename node_type::node_ptr bound = NULL;
+        while (node)
+        {
+            if (m_Comparator(k, KeyExtract()(node->m_Value)))
             {
+                bound = node;
                 node = node->m_Left;
             }
             else
@@ -479,204 +524,153 @@ public:
                 node = node->m_Right;
             }
         }
-        return NULL;
+        return bound;
     }
 
-    typename node_type::node_ptr lower_bound(const Key& k) const
+    size_type count(const Key& k) const /// two descents and a walk over the matches, O(log n + count)
     {
-        iterator it(this, get_min());
-        while (it.base() && m_Comparator(KeyExtract()(*it), k))
+        size_type cnt = 0;
+        typename node_type::node_ptr last = upper_bound(k);
+        for (typename node_type::node_ptr node = lower_bound(k); node != last; node = RbTreeStep<Threaded>::next(node))
         {
-            ++it;
+            ++cnt;
         }
-        return it.base();
+        return cnt;
     }
 
-    typename node_type::node_ptr upper_bound(const Key& k) const
+    typename node_type::node_ptr add(Val toAdd) /// returns the node already holding an equal key, if any
+    {
+        typename node_type::node_ptr added = NULL;
+
+        m_Root = add(NULL, m_Root, toAdd, true, true, &added);
+        m_Root->m_Color = BLACK;
+        return added;
+    }
+
+    typename node_type::node_ptr add(iterator hint, Val value) { return add(hint.base(), value); }
+    typename node_type::node_ptr add(typename node_type::node_ptr hint, Val value) /// O(1) amortized when value belongs right before hint
     {
-        iterator it(this, get_min());
-        while (it.base() && !m_Comparator(k, KeyExtract()(*it)))
+        typename node_type::node_ptr prev = hint ? RbTreeStep<Threaded>::prev(hint) : get_max();
+        if (prev && !m_Comparator(KeyExtract()(prev->m_Value), KeyExtract()(value)))
         {
-            ++it;
+            return m_Comparator(KeyExtract()(value), KeyExtract()(prev->m_Value)) ? add(value) : prev;
         }
-        return it.base();
+        if (hint && !m_Comparator(KeyExtract()(value), KeyExtract()(hint->m_Value)))
+        {
+            return m_Comparator(KeyExtract()(hint->m_Value), KeyExtract()(value)) ? add(value) : hint;
+        }
+        return insertBefore(hint, prev, value);
     }
 
-    typename node_type::node_ptr add(Val toAdd)
+    typename node_type::node_ptr add_equal(Val toAdd) /// equal keys keep insertion order
     {
         typename node_type::node_ptr added = NULL;
 
-        m_Root = add(NULL, m_Root, toAdd, true, &added);
+        m_Root = add(NULL, m_Root, toAdd, true, false, &added);
         m_Root->m_Color = BLACK;
         return added;
     }
 
-    typename node_type::node_ptr add(iterator it, Val value) { return add(it.base(), value); }
-    typename node_type::node_ptr add(typename node_type::node_ptr preceding, Val value)
+    typename node_type::node_ptr add_equal(iterator hint, Val value) { return add_equal(hint.base(), value); }
+    typename node_type::node_ptr add_equal(typename node_type::node_ptr hint, Val value) /// O(1) amortized when value belongs right before hint
     {
-        bool first = false;
-        iterator it(this, preceding);
-        while (it.base())
+        typename node_type::node_ptr prev = hint ? RbTreeStep<Threaded>::prev(hint) : get_max();
+        if (prev && m_Comparator(KeyExtract()(value), KeyExtract()(prev->m_Value)))
         {
-            if (m_Comparator(KeyExtract()(value), KeyExtract()(*it)))
-            {
-                first = true;
-                --it;
-            }
-            else if (m_Comparator(KeyExtract()(*it), KeyExtract()(value)))
-            {
-                if (first)
-                    break;
-                ++it;
-            }
-            else
-            {
-                typename node_type::node_ptr added = m_Allocator.allocate(1);
-                {
-                    m_Allocator.construct(added, value);
-                    added->m_Parent = it.base()->m_Parent;
-                    added->m_IsLeft = it.base()->m_IsLeft;
-                }
-                if (added->m_Parent)
-                    added->m_IsLeft ? added->m_Parent->m_Left = added : added->m_Parent->m_Right = added;
-                else
-                    m_Root = added;
-                added->m_Left = it.base()->m_Left;
-                if (added->m_Left)
-                    added->m_Left->m_Parent = added;
-                it.base()->m_Left = NULL;
-                it.base()->m_IsLeft = false;
-                added->m_Right = it.base();
-                it.base()->m_Parent = added;
-                ++m_Size;
-                return added;
-            }
+            return add_equal(value);
         }
-        return add(value);
+        if (hint && m_Comparator(KeyExtract()(hint->m_Value), KeyExtract()(value))) /// closest to hint is before the equal keys
+        {
+            hint = lower_bound(KeyExtract()(value));
+            prev = hint ? RbTreeStep<Threaded>::prev(hint) : get_max();
+        }
+        return insertBefore(hint, prev, value);
     }
 
     bool deleteKey(const Key& k)
     {
-        if (!find(m_Root, k))
+        typename node_type::node_ptr found = find(k);
+        if (!found)
         {
             return false;
         }
-        if (m_Size < 2)
-        {
-            m_Size = 0;
-            m_Allocator.destroy(m_Root);
-            m_Root = NULL;
-            return true;
-        }
+        deleteKey(found);
+        return true;
+    }
+
+    typename node_type::node_ptr deleteKey(iterator it) { return deleteKey(it.base()); }
+    typename node_type::node_ptr deleteKey(typename node_type::node_ptr x) /// returns the in-order successor
+    {
+        typename node_type::node_ptr next = RbTreeStep<Threaded>::next(x);
         if (!isRed(m_Root->m_Left) && !isRed(m_Root->m_Right))
-            m_Root->m_Color = RbTreeColor::RED;
-        m_Root = deleteKey(m_Root, k);
+            m_Root->m_Color = RED;
+        m_Root = deleteNode(m_Root, x);
         if (m_Root)
-            m_Root->m_Color = RbTreeColor::BLACK;
-        return true;
+            m_Root->m_Color = BLACK;
+        --m_Size;
+        return next;
     }
 
-    typename node_type::node_ptr deleteKey(typename node_type::node_ptr x, const Key& k)
+    template <typename Predicate>
+    size_type erase_if(Predicate pred) /// one in-order pass, then either a few rebalancing erases or one rebuild
     {
-        if (m_Comparator(k, KeyExtract()(x->m_Value)))
-        {
-            if (!isRed(x->m_Left) && x->m_Left && !isRed(x->m_Left->m_Left))
-                x = moveRedLeft(x);
-            x->m_Left = deleteKey(x->m_Left, k);
-        }
-        else
+        vector<typename node_type::node_ptr> erased;
+        for (typename node_type::node_ptr node = get_min(); node; node = RbTreeStep<Threaded>::next(node))
         {
-            if (isRed(x->m_Left))
-                x = rotateRight(x);
-            if (!m_Comparator(KeyExtract()(x->m_Value), k) && !x->m_Right)
+            if (pred(node->m_Value))
             {
-                --m_Size;
-                m_Allocator.destroy(x);
-                return NULL;
+                erased.push_back(node);
             }
-            if (!isRed(x->m_Right) && x->m_Right && !isRed(x->m_Right->m_Left))
-                x = moveRedRight(x);
-            if (!m_Comparator(KeyExtract()(x->m_Value), k) && !m_Comparator(k, KeyExtract()(x->m_Value)))
+        }
+        if (erased.empty())
+        {
+            return 0;
+        }
+
+        if (erased.size() * s_RebuildFraction < m_Size)
+        {
+            for (size_type i = 0; i < erased.size(); ++i)
             {
-                typename node_type::node_ptr h = get_min(x->m_Right);
-                rewrite_value(x->m_Value, h->m_Value);
-                x->m_Right = deleteMin(x->m_Right);
+                deleteKey(erased[i]);
             }
-            else
-                x->m_Right = deleteKey(x->m_Right, k);
+            return erased.size();
         }
-        return balance(x);
-    }
 
-    typename node_type::node_ptr deleteKey(iterator it) { return deleteKey(it.base()); }
-    typename node_type::node_ptr deleteKey(typename node_type::node_ptr x)
-    {
-        typename node_type::node_ptr ret = NULL;
-        if (!x)
-            return x;
-        if (m_Size == 1)
-            m_Root = NULL;
-        else if (!x->m_Right)
+        typename node_type::node_ptr kept = NULL;
+        typename node_type::node_ptr kept_tail = NULL;
+        size_type kept_cnt = 0;
+        size_type erased_idx = 0;
+        for (typename node_type::node_ptr node = get_min(); node; )
         {
-            if (!x->m_Parent)
+            typename node_type::node_ptr next = RbTreeStep<Threaded>::next(node);
+            if (erased_idx < erased.size() && erased[erased_idx] == node)
             {
-                m_Root = x->m_Left;
-                m_Root->m_Parent = NULL;
+                ++erased_idx;
             }
             else
             {
-                (x->m_IsLeft) ? x->m_Parent->m_Left = x->m_Left : x->m_Parent->m_Right = x->m_Left;
-                if (x->m_Left)
-                {
-                    x->m_Left->m_IsLeft = x->m_IsLeft;
-                    x->m_Left->m_Parent = x->m_Parent;
-                }
-                if (x->m_IsLeft)
-                    ret = x->m_Parent;
-                else
-                {
-                    iterator it(this, x);
-                    ++it;
-                    ret = it.base();
-                }
+                /// visited nodes are only climbed through m_Parent, so m_Right can chain the survivors
+                kept_tail ? kept_tail->m_Right = node : kept = node;
+                kept_tail = node;
+                ++kept_cnt;
             }
+            node = next;
         }
-        else
+        for (size_type i = 0; i < erased.size(); ++i)
         {
-            ret = eraseRight(x);
+            destroyNode(erased[i]);
         }
-        --m_Size;
-        m_Allocator.destroy(x);
-        return ret;
-    }
-
-    typename node_type::node_ptr eraseRight(typename node_type::node_ptr x)
-    {
-        typename node_type::node_ptr h = get_min(x->m_Right);
 
-        h->m_IsLeft ? h->m_Parent->m_Left = h->m_Right : h->m_Parent->m_Right = h->m_Right;
-        if (h->m_Parent->m_Left)
-        {
-            h->m_Parent->m_Left->m_Parent = h->m_Parent;
-            h->m_Parent->m_Left->m_IsLeft = true;
-        }
-        if (h->m_Parent->m_Right)
-            h->m_Parent->m_Right->m_Parent = h->m_Parent;
-        h->m_IsLeft = x->m_IsLeft;
-        h->m_Color = x->m_Color;
-        h->m_Parent = x->m_Parent;
-        if (!h->m_Parent)
-            m_Root = h;
-        else
-            x->m_IsLeft ? h->m_Parent->m_Left = h : h->m_Parent->m_Right = h;
-        if (x->m_Right)
+        m_Size = kept_cnt;
+        m_Root = build(kept, kept_cnt, 0, redDepth(kept_cnt));
+        if (m_Root)
         {
-            h->m_Right = x->m_Right;
-            h->m_Right->m_Parent = h;
+            m_Root->m_Parent = NULL;
+            m_Root->m_IsLeft = true;
+            m_Root->m_Color = BLACK;
         }
-        h->m_Left = x->m_Left;
-        h->m_Left ? h->m_Left->m_Parent = h : NULL;
-        return h;
+        rethread(bool_constant<Threaded>());
+        return erased.size();
     }
 
     typename node_type::node_ptr get_min() const
@@ -712,6 +706,7 @@ private:
                                      typename node_type::node_ptr x,
                                      Val& value,
                                      bool left,
+                                     bool unique,
                                      typename node_type::node_ptr *added)
     {
         if (x == NULL)
@@ -721,19 +716,20 @@ private:
             m_Allocator.construct(*added, value);
             (*added)->m_Parent = parent;
             (*added)->m_IsLeft = left;
+            linkLeaf(*added, bool_constant<Threaded>());
             return *added;
         }
-        if (!m_Comparator(KeyExtract()(x->m_Value), KeyExtract()(value)) && !m_Comparator(KeyExtract()(value), KeyExtract()(x->m_Value)))
+        if (unique && !m_Comparator(KeyExtract()(x->m_Value), KeyExtract()(value)) && !m_Comparator(KeyExtract()(value), KeyExtract()(x->m_Value)))
         {
             *added = x;
         }
         else if (!m_Comparator(KeyExtract()(value), KeyExtract()(x->m_Value)))
         {
-            x->m_Right = add(x, x->m_Right, value, false, added);
+            x->m_Right = add(x, x->m_Right, value, false, unique, added);
         }
         else
         {
-            x->m_Left = add(x, x->m_Left, value, true, added);
+            x->m_Left = add(x, x->m_Left, value, true, unique, added);
         }
 
         if (isRed(x->m_Right) && !isRed(x->m_Left))
@@ -751,57 +747,131 @@ private:
         return x;
     }
 
-    void deleteMin()
+    typename node_type::node_ptr insertBefore(typename node_type::node_ptr hint,
+                                              typename node_type::node_ptr prev,
+                                              Val& value)
     {
+        typename node_type::node_ptr added = m_Allocator.allocate(1);
+        m_Allocator.construct(added, value);
+        ++m_Size;
         if (m_Root == NULL)
-            return;
-        if (!isRed(m_Root->m_Left && !isRed(m_Root->m_Right)))
-            m_Root->m_Color = RbTreeColor::RED;
-        m_Root = deleteMin(m_Root);
-        if (m_Root)
-            m_Root->m_Color = RbTreeColor::BLACK;
+        {
+            m_Root = added;
+        }
+        else if (hint && hint->m_Left == NULL)
+        {
+            added->m_Parent = hint;
+            added->m_IsLeft = true;
+            hint->m_Left = added;
+        }
+        else /// prev is the maximum of hint's left subtree or of the whole tree
+        {
+            added->m_Parent = prev;
+            added->m_IsLeft = false;
+            prev->m_Right = added;
+        }
+        linkLeaf(added, bool_constant<Threaded>());
+        fixUp(added->m_Parent);
+        m_Root->m_Color = BLACK;
+        return added;
     }
 
-    typename node_type::node_ptr deleteMin(typename node_type::node_ptr h)
+    void fixUp(typename node_type::node_ptr x) /// bottom-up fixup after linking a red leaf, stops at the first black subtree root
     {
-        if (!h->m_Left)
+        while (x)
         {
-            --m_Size;
-            m_Allocator.destroy(h);
-            return NULL;
+            typename node_type::node_ptr parent = x->m_Parent;
+            bool left = x->m_IsLeft;
+
+            if (isRed(x->m_Right) && !isRed(x->m_Left))
+                x = rotateLeft(x);
+            if (isRed(x->m_Left) && isRed(x->m_Left->m_Left))
+                x = rotateRight(x);
+            if (isRed(x->m_Left) && isRed(x->m_Right))
+                colorFlip(x);
+
+            if (parent == NULL)
+                m_Root = x;
+            else
+                left ? parent->m_Left = x : parent->m_Right = x;
+            if (!isRed(x))
+                break;
+            x = parent;
         }
-        if (!isRed(h->m_Left) && !isRed(h->m_Left->m_Left))
-            h = moveRedLeft(h);
-        h->m_Left = deleteMin(h->m_Left);
-        return balance(h);
     }
 
-    void deleteMax()
+    /// target lies in the left subtree of h. Distinct keys decide with one comparison; equal
+    /// keys walk up from target to h, so each deleteNode step can cost O(log n) and erasing
+    /// among many equal keys is O(log^2 n).
+    bool precedes(typename node_type::node_ptr target, typename node_type::node_ptr h)
     {
-        if (m_Root == NULL)
-            return;
-        if (!isRed(m_Root->m_Left && !isRed(m_Root->m_Right)))
-            m_Root->m_Color = RbTreeColor::RED;
+        if (m_Comparator(KeyExtract()(target->m_Value), KeyExtract()(h->m_Value)))
+            return true;
+        if (m_Comparator(KeyExtract()(h->m_Value), KeyExtract()(target->m_Value)))
+            return false;
+        for (typename node_type::node_ptr node = target; node != h && node->m_Parent; node = node->m_Parent)
+        {
+            if (node->m_Parent == h)
+                return node->m_IsLeft;
+        }
+        return false;
+    }
 
-        m_Root = deleteMax(m_Root);
-        if (m_Root)
-            m_Root->m_Color = RbTreeColor::BLACK;
+    typename node_type::node_ptr deleteNode(typename node_type::node_ptr h, typename node_type::node_ptr target)
+    {
+        if (precedes(target, h))
+        {
+            if (!isRed(h->m_Left) && !isRed(h->m_Left->m_Left))
+                h = moveRedLeft(h);
+            h->m_Left = deleteNode(h->m_Left, target);
+        }
+        else
+        {
+            if (isRed(h->m_Left))
+                h = rotateRight(h);
+            if (h == target && !h->m_Right)
+            {
+                destroyNode(h);
+                return NULL;
+            }
+            if (!isRed(h->m_Right) && !isRed(h->m_Right->m_Left))
+                h = moveRedRight(h);
+            if (h == target) /// relink the successor node in place, other nodes keep their values
+            {
+                typename node_type::node_ptr successor = NULL;
+                typename node_type::node_ptr right = detachMin(h->m_Right, &successor);
+
+                successor->m_Parent = h->m_Parent;
+                successor->m_IsLeft = h->m_IsLeft;
+                successor->m_Color = h->m_Color;
+                successor->m_Left = h->m_Left;
+                if (successor->m_Left)
+                    successor->m_Left->m_Parent = successor;
+                successor->m_Right = right;
+                if (right)
+                {
+                    right->m_Parent = successor;
+                    right->m_IsLeft = false;
+                }
+                destroyNode(h);
+                h = successor;
+            }
+            else
+                h->m_Right = deleteNode(h->m_Right, target);
+        }
+        return balance(h);
     }
 
-    typename node_type::node_ptr deleteMax(typename node_type::node_ptr h)
+    typename node_type::node_ptr detachMin(typename node_type::node_ptr h, typename node_type::node_ptr* min)
     {
-        if (isRed(h->m_Left))
-            h = rotateRight(h);
-        if (h->m_Right == NULL)
+        if (!h->m_Left)
         {
-            --m_Size;
-            m_Allocator.destroy(h);
+            *min = h;
             return NULL;
         }
-        if (!isRed(h->m_Right) && !isRed(h->m_Right->m_Left))
-            h = moveRedRight(h->m_Right);
-
-        h->m_Right = deleteMax(h->m_Right);
+        if (!isRed(h->m_Left) && !isRed(h->m_Left->m_Left))
+            h = moveRedLeft(h);
+        h->m_Left = detachMin(h->m_Left, min);
         return balance(h);
     }
 
@@ -812,21 +882,6 @@ private:
         node->m_Right->m_Color = (node->m_Right->m_Color == RED) ? BLACK : RED;
     }
 
-    template <typename Type>
-    typename enable_if<is_same<Type, Key>::value>::type
-    rewrite_value(Type& val, Type& new_val)
-    {
-        val = new_val;
-    }
-
-    template <typename Type>
-    typename enable_if<!is_same<Type, Key>::value>::type
-    rewrite_value(Type& val, Type& new_val)
-    {
-        const_cast<Key&>(val.first) = new_val.first;
-        val.second = new_val.second;
-    }
-
     typename node_type::node_ptr rotateLeft(typename node_type::node_ptr h)
     {
         typename node_type::node_ptr x = h->m_Right;
@@ -907,6 +962,7 @@ private:
         deleteTree(node->m_Left);
         deleteTree(node->m_Right);
         m_Allocator.destroy(node);
+        m_Allocator.deallocate(node, 1);
     }
 
     void copyTree(typename node_type::node_ptr dest, typename node_type::node_ptr src)
@@ -929,6 +985,101 @@ private:
         }
     }
 
+    static size_type redDepth(size_type cnt) /// the lowest level of a non-perfect balanced tree is red
+    {
+        size_type depth = 0;
+        while ((size_type(2) << depth) <= cnt)
+        {
+            ++depth;
+        }
+        return ((cnt + 1) & cnt) ? depth : static_cast<size_type>(-1);
+    }
+
+    typename node_type::node_ptr build(typename node_type::node_ptr& sorted,
+                                       size_type cnt,
+                                       size_type depth,
+                                       size_type red_depth)
+    {
+        if (cnt == 0)
+            return NULL;
+
+        typename node_type::node_ptr left = build(sorted, cnt / 2, depth + 1, red_depth);
+        typename node_type::node_ptr h = sorted;
+        sorted = sorted->m_Right;
+
+        h->m_Left = left;
+        if (left)
+        {
+            left->m_Parent = h;
+            left->m_IsLeft = true;
+        }
+        h->m_Right = build(sorted, cnt - 1 - cnt / 2, depth + 1, red_depth);
+        if (h->m_Right)
+        {
+            h->m_Right->m_Parent = h;
+            h->m_Right->m_IsLeft = false;
+        }
+        h->m_Color = (depth == red_depth) ? RED : BLACK;
+        return balance(h);
+    }
+
+    void destroyNode(typename node_type::node_ptr node)
+    {
+        unlink(node, bool_constant<Threaded>());
+        m_Allocator.destroy(node);
+        m_Allocator.deallocate(node, 1);
+    }
+
+    void link(typename node_type::node_ptr node,
+              typename node_type::node_ptr prev,
+              typename node_type::node_ptr next)
+    {
+        node->m_Prev = prev;
+        node->m_Next = next;
+        if (prev)
+            prev->m_Next = node;
+        if (next)
+            next->m_Prev = node;
+    }
+
+    void linkLeaf(typename node_type::node_ptr, false_type) {}
+    void linkLeaf(typename node_type::node_ptr leaf, true_type) /// a fresh leaf sits right next to its parent
+    {
+        typename node_type::node_ptr parent = leaf->m_Parent;
+        if (parent == NULL)
+            link(leaf, NULL, NULL);
+        else if (leaf->m_IsLeft)
+            link(leaf, parent->m_Prev, parent);
+        else
+            link(leaf, parent, parent->m_Next);
+    }
+
+    void linkBefore(typename node_type::node_ptr, typename node_type::node_ptr, false_type) {}
+    void linkBefore(typename node_type::node_ptr node, typename node_type::node_ptr next, true_type)
+    {
+        link(node, next->m_Prev, next);
+    }
+
+    void unlink(typename node_type::node_ptr, false_type) {}
+    void unlink(typename node_type::node_ptr node, true_type)
+    {
+        if (node->m_Prev)
+            node->m_Prev->m_Next = node->m_Next;
+        if (node->m_Next)
+            node->m_Next->m_Prev = node->m_Prev;
+    }
+
+    void rethread(false_type) {}
+    void rethread(true_type) /// copied nodes still point into the source tree
+    {
+        typename node_type::node_ptr prev = NULL;
+        for (typename node_type::node_ptr node = get_min(); node; node = RbTreeStep<false>::next(node))
+        {
+            link(node, prev, NULL);
+            prev = node;
+        }
+    }
+
     bool isRed(typename node_type::node_ptr n)
     {
         if (n == NULL)
@@ -0,0 +1,420 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include "iterator_traits.h"
+#include "type_traits.h"
+#include "reverse_iter.h"
+#include "algorithm.h"
+#include "memory.h"
+
+namespace ft
+{
+
+/// LIFO sequence on a doubly linked chain of fixed chunks, meant as the container of ft::stack.
+/// push_back either constructs into the top chunk or steps to the chunk above it, so no element
+/// ever moves and no push costs more than one chunk allocation. Emptied chunks stay linked
+/// above the top as a cache: popping and pushing across a chunk boundary never allocates, and
+/// after reserve(n) the first n pushes never allocate at all. shrink_to_fit frees the cache.
+template <typename TType, std::size_t ChunkSize = (sizeof(TType) < 256 ? 4096 / sizeof(TType) : 16),
+          typename TAllocator = std::allocator<TType> >
+class segment_stack
+{
+public:
+    typedef TType value_type;
+    typedef TAllocator allocator_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename allocator_type::reference reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer pointer;
+    typedef typename allocator_type::const_pointer const_pointer;
+
+    static const size_type chunk_size = ChunkSize;
+
+private:
+    struct chunk
+    {
+        chunk* m_Below;
+        chunk* m_Above;
+        alignas(TType) unsigned char m_Buffer[ChunkSize * sizeof(TType)];
+
+        pointer slots() { return reinterpret_cast<pointer>(m_Buffer); }
+    };
+
+    typedef typename allocator_type::template rebind<chunk>::other chunk_allocator;
+
+    template <bool Const>
+    class Iterator /// bottom to top; stays valid until its element is popped
+    {
+        friend class segment_stack;
+        friend class Iterator<!Const>;
+
+        chunk* m_Chunk;
+        chunk* m_Last; /// top chunk when the iterator was made, where end() lives
+        size_type m_Index;
+
+        Iterator(chunk* current, chunk* last, size_type index) : m_Chunk(current), m_Last(last), m_Index(index) {}
+
+    public:
+        typedef bidirectional_iterator_tag iterator_category;
+        typedef TType value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename conditional<Const, const TType*, TType*>::type pointer;
+        typedef typename conditional<Const, const TType&, TType&>::type reference;
+
+        Iterator() : m_Chunk(NULL), m_Last(NULL), m_Index(0) {}
+
+        template <bool OtherConst>
+        Iterator(const Iterator<OtherConst>& other, typename enable_if<Const && !OtherConst>::type* = NULL)
+            : m_Chunk(other.m_Chunk)
+            , m_Last(other.m_Last)
+            , m_Index(other.m_Index)
+        {}
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.m_Chunk == rhs.m_Chunk && lhs.m_Index == rhs.m_Index;
+        }
+
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return !(lhs == rhs); }
+
+        reference operator*() const { return m_Chunk->slots()[m_Index]; }
+        pointer operator->() const { return m_Chunk->slots() + m_Index; }
+
+        // prefix version
+        Iterator& operator++()
+        {
+            if (++m_Index == ChunkSize && m_Chunk != m_Last)
+            {
+                m_Chunk = m_Chunk->m_Above;
+                m_Index = 0;
+            }
+            return *this;
+        }
+
+        Iterator& operator--()
+        {
+            if (m_Index == 0)
+            {
+                m_Chunk = m_Chunk->m_Below;
+                m_Index = ChunkSize;
+            }
+            --m_Index;
+            return *this;
+        }
+
+        // postfix version
+        Iterator operator++(int)
+        {
+            Iterator temp(*this);
+            ++*this;
+            return temp;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator temp(*this);
+            --*this;
+            return temp;
+        }
+    };
+
+public:
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+    typedef ReverseIterator<iterator> reverse_iterator;
+    typedef ReverseIterator<const_iterator> const_reverse_iterator;
+
+private:
+    allocator_type m_Allocator;
+    chunk_allocator m_ChunkAllocator;
+    chunk* m_Bottom;
+    chunk* m_Top; /// holds the last element, never empty unless it is m_Bottom
+    size_type m_Used; /// elements in m_Top
+    size_type m_Size;
+    size_type m_Chunks;
+
+public:
+    explicit segment_stack(const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_ChunkAllocator(alloc)
+        , m_Bottom(NULL)
+        , m_Top(NULL)
+        , m_Used(0)
+        , m_Size(0)
+        , m_Chunks(0)
+    {}
+
+    segment_stack(const segment_stack& other)
+        : m_Allocator(other.m_Allocator)
+        , m_ChunkAllocator(other.m_ChunkAllocator)
+        , m_Bottom(NULL)
+        , m_Top(NULL)
+        , m_Used(0)
+        , m_Size(0)
+        , m_Chunks(0)
+    {
+        try
+        {
+            append_from(other);
+        }
+        catch (...)
+        {
+            clear();
+            release_chunks();
+            throw;
+        }
+    }
+
+    segment_stack& operator=(const segment_stack& other)
+    {
+        if (&other != this)
+        {
+            clear();
+            append_from(other);
+        }
+        return *this;
+    }
+
+    ~segment_stack()
+    {
+        clear();
+        release_chunks();
+    }
+
+    allocator_type get_allocator() const
+    {
+        return m_Allocator;
+    }
+
+    // iterator methods
+    iterator begin() { return iterator(m_Bottom, m_Top, 0); }
+    const_iterator begin() const { return const_iterator(m_Bottom, m_Top, 0); }
+    iterator end() { return iterator(m_Top, m_Top, m_Used); }
+    const_iterator end() const { return const_iterator(m_Top, m_Top, m_Used); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    // capacity methods
+    size_type size() const { return m_Size; }
+    size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(value_type); }
+    size_type capacity() const { return m_Chunks * ChunkSize; }
+    bool empty() const { return m_Size == 0; }
+
+    void reserve(size_type new_capacity) /// links the missing chunks above the top
+    {
+        if (new_capacity > max_size())
+        {
+            throw std::length_error("reserve of segment_stack: new capacity is too much");
+        }
+        chunk* last = m_Top;
+        while (last != NULL && last->m_Above != NULL)
+        {
+            last = last->m_Above;
+        }
+        while (capacity() < new_capacity)
+        {
+            last = add_chunk(last);
+        }
+    }
+
+    void shrink_to_fit() /// frees the cached chunks above the top
+    {
+        if (m_Size == 0)
+        {
+            release_chunks();
+            return;
+        }
+        chunk* cached = m_Top->m_Above;
+        m_Top->m_Above = NULL;
+        while (cached != NULL)
+        {
+            chunk* above = cached->m_Above;
+            m_ChunkAllocator.deallocate(cached, 1);
+            --m_Chunks;
+            cached = above;
+        }
+    }
+
+    // element access methods
+    reference back() { return m_Top->slots()[m_Used - 1]; }
+    const_reference back() const { return m_Top->slots()[m_Used - 1]; }
+
+    // modifiers methods
+    void push_back(const value_type& val) /// elements never move, so val stays valid
+    {
+        if (m_Used < ChunkSize && m_Top != NULL)
+        {
+            m_Allocator.construct(m_Top->slots() + m_Used, val);
+            ++m_Used;
+        }
+        else
+        {
+            chunk* next = m_Top == NULL ? NULL : m_Top->m_Above;
+            if (next == NULL)
+            {
+                next = add_chunk(m_Top);
+            }
+            m_Allocator.construct(next->slots(), val);
+            m_Top = next;
+            m_Used = 1;
+        }
+        ++m_Size;
+    }
+
+    void pop_back()
+    {
+        --m_Used;
+        --m_Size;
+        m_Allocator.destroy(m_Top->slots() + m_Used);
+        if (m_Used == 0 && m_Top != m_Bottom)
+        {
+            m_Top = m_Top->m_Below;
+            m_Used = ChunkSize;
+        }
+    }
+
+    void swap(segment_stack& x)
+    {
+        allocator_type tmp_alloc = m_Allocator;
+        chunk* tmp_bottom = m_Bottom;
+        chunk* tmp_top = m_Top;
+        size_type tmp_used = m_Used;
+        size_type tmp_size = m_Size;
+        size_type tmp_chunks = m_Chunks;
+
+        m_Allocator = x.m_Allocator;
+        m_ChunkAllocator = chunk_allocator(x.m_Allocator);
+        m_Bottom = x.m_Bottom;
+        m_Top = x.m_Top;
+        m_Used = x.m_Used;
+        m_Size = x.m_Size;
+        m_Chunks = x.m_Chunks;
+
+        x.m_Allocator = tmp_alloc;
+        x.m_ChunkAllocator = chunk_allocator(tmp_alloc);
+        x.m_Bottom = tmp_bottom;
+        x.m_Top = tmp_top;
+        x.m_Used = tmp_used;
+        x.m_Size = tmp_size;
+        x.m_Chunks = tmp_chunks;
+    }
+
+    void clear() /// keeps the chunks for reuse
+    {
+        while (m_Size != 0)
+        {
+            ft::destroy_n(m_Allocator, m_Top->slots(), m_Used);
+            m_Size -= m_Used;
+            if (m_Top != m_Bottom)
+            {
+                m_Top = m_Top->m_Below;
+                m_Used = ChunkSize;
+            }
+        }
+        m_Top = m_Bottom;
+        m_Used = 0;
+    }
+
+private:
+    chunk* add_chunk(chunk* below) /// links a new chunk above below, or as the bottom one
+    {
+        chunk* fresh = m_ChunkAllocator.allocate(1);
+        fresh->m_Below = below;
+        fresh->m_Above = NULL;
+        if (below == NULL)
+        {
+            m_Bottom = fresh;
+            m_Top = fresh;
+        }
+        else
+        {
+            below->m_Above = fresh;
+        }
+        ++m_Chunks;
+        return fresh;
+    }
+
+    void release_chunks() /// only when empty
+    {
+        while (m_Bottom != NULL)
+        {
+            chunk* above = m_Bottom->m_Above;
+            m_ChunkAllocator.deallocate(m_Bottom, 1);
+            m_Bottom = above;
+        }
+        m_Top = NULL;
+        m_Chunks = 0;
+    }
+
+    void append_from(const segment_stack& other)
+    {
+        reserve(other.m_Size);
+        for (const_iterator it = other.begin(); it != other.end(); ++it)
+        {
+            push_back(*it);
+        }
+    }
+};
+
+/// Chunks link only to each other, never back to the container
+template <typename TType, std::size_t ChunkSize, typename TAlloc>
+struct is_trivially_relocatable<segment_stack<TType, ChunkSize, TAlloc> > : is_trivially_relocatable<TAlloc>
+{};
+
+template <typename TType, std::size_t ChunkSize, typename TAllocator>
+const std::size_t segment_stack<TType, ChunkSize, TAllocator>::chunk_size;
+
+template <typename TType, std::size_t ChunkSize, typename TAlloc>
+void swap(segment_stack<TType, ChunkSize, TAlloc>& x, segment_stack<TType, ChunkSize, TAlloc>& y)
+{
+    x.swap(y);
+}
+
+template <typename TType, std::size_t ChunkSize, typename TAlloc>
+bool operator==(const segment_stack<TType, ChunkSize, TAlloc>& lhs, const segment_stack<TType, ChunkSize, TAlloc>& rhs)
+{
+    return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename TType, std::size_t ChunkSize, typename TAlloc>
+bool operator!=(const segment_stack<TType, ChunkSize, TAlloc>& lhs, const segment_stack<TType, ChunkSize, TAlloc>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename TType, std::size_t ChunkSize, typename TAlloc>
+bool operator<(const segment_stack<TType, ChunkSize, TAlloc>& lhs, const segment_stack<TType, ChunkSize, TAlloc>& rhs)
+{
+    return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename TType, std::size_t ChunkSize, typename TAlloc>
+bool operator>(const segment_stack<TType, ChunkSize, TAlloc>& lhs, const segment_stack<TType, ChunkSize, TAlloc>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename TType, std::size_t ChunkSize, typename TAlloc>
+bool operator<=(const segment_stack<TType, ChunkSize, TAlloc>& lhs, const segment_stack<TType, ChunkSize, TAlloc>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename TType, std::size_t ChunkSize, typename TAlloc>
+bool operator>=(const segment_stack<TType, ChunkSize, TAlloc>& lhs, const segment_stack<TType, ChunkSize, TAlloc>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+}
@@ -0,0 +1,371 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "index_iter.h"
+#include "reverse_iter.h"
+#include "algorithm.h"
+#include "vector.h"
+
+namespace ft
+{
+
+/// Sequence of fixed blocks of BlockSize elements found through a directory of block pointers.
+/// Growing allocates one more block and never moves elements, so references stay valid
+/// until the element is removed. Only the end of the sequence can change.
+template <typename TType, std::size_t BlockSize = 1024, typename TAllocator = std::allocator<TType> >
+class segmented_vector
+{
+    static_assert(BlockSize != 0 && (BlockSize & (BlockSize - 1)) == 0, "segmented_vector: BlockSize must be a power of two");
+
+public:
+    typedef TType value_type;
+    typedef TAllocator allocator_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename allocator_type::reference reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer pointer;
+    typedef typename allocator_type::const_pointer const_pointer;
+    typedef IndexIterator<segmented_vector, false> iterator;
+    typedef IndexIterator<segmented_vector, true> const_iterator;
+    typedef ReverseIterator<iterator> reverse_iterator;
+    typedef ReverseIterator<const_iterator> const_reverse_iterator;
+
+    static const size_type block_size = BlockSize;
+
+private:
+    typedef typename allocator_type::template rebind<pointer>::other directory_allocator;
+    typedef vector<pointer, directory_allocator> directory_type;
+
+    allocator_type m_Allocator;
+    directory_type m_Directory;
+    size_type m_Size;
+
+public:
+    explicit segmented_vector(const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_Size(0)
+    {}
+
+    explicit segmented_vector(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_Size(0)
+    {
+        try
+        {
+            resize(count, value);
+        }
+        catch (...)
+        {
+            release_all();
+            throw;
+        }
+    }
+
+    template <typename InputIterator>
+    segmented_vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+                     typename enable_if<!is_integral<InputIterator>::value>::type* = NULL)
+        : m_Allocator(alloc)
+        , m_Size(0)
+    {
+        try
+        {
+            for (; first != last; ++first)
+            {
+                push_back(*first);
+            }
+        }
+        catch (...)
+        {
+            release_all();
+            throw;
+        }
+    }
+
+    segmented_vector(const segmented_vector& other)
+        : m_Allocator(other.m_Allocator)
+        , m_Size(0)
+    {
+        try
+        {
+            append_from(other);
+        }
+        catch (...)
+        {
+            release_all();
+            throw;
+        }
+    }
+
+    segmented_vector& operator=(const segmented_vector& other)
+    {
+        if (&other != this)
+        {
+            clear();
+            append_from(other);
+        }
+        return *this;
+    }
+
+    ~segmented_vector()
+    {
+        release_all();
+    }
+
+    allocator_type get_allocator() const
+    {
+        return m_Allocator;
+    }
+
+    // iterator methods
+    iterator begin() { return iterator(this, 0); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    iterator end() { return iterator(this, m_Size); }
+    const_iterator end() const { return const_iterator(this, m_Size); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    // capacity methods
+    size_type size() const { return m_Size; }
+    size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(value_type); }
+    size_type capacity() const { return m_Directory.size() * BlockSize; }
+    bool empty() const { return m_Size == 0; }
+
+    void resize(size_type new_size, const value_type& val = value_type())
+    {
+        if (new_size > m_Size)
+        {
+            reserve(new_size);
+            while (m_Size < new_size)
+            {
+                m_Allocator.construct(slot(m_Size), val);
+                ++m_Size;
+            }
+        }
+        else
+        {
+            destroy_from(new_size);
+        }
+    }
+
+    void reserve(size_type new_capacity) /// allocates the missing blocks up front
+    {
+        if (new_capacity > max_size())
+        {
+            throw std::length_error("reserve of segmented_vector: new capacity is too much");
+        }
+        m_Directory.reserve((new_capacity + BlockSize - 1) / BlockSize);
+        while (capacity() < new_capacity)
+        {
+            add_block();
+        }
+    }
+
+    void shrink_to_fit() /// frees the blocks past the last element
+    {
+        release_blocks((m_Size + BlockSize - 1) / BlockSize);
+        m_Directory.shrink_to_fit();
+    }
+
+    // element access methods
+    reference operator[](size_type position) { return *slot(position); }
+    const_reference operator[](size_type position) const { return *slot(position); }
+
+    reference at(size_type position)
+    {
+        if (position >= m_Size)
+        {
+            throw std::out_of_range("out of range of segmented_vector");
+        }
+        return *slot(position);
+    }
+
+    const_reference at(size_type position) const
+    {
+        if (position >= m_Size)
+        {
+            throw std::out_of_range("out of range of segmented_vector");
+        }
+        return *slot(position);
+    }
+
+    reference front() { return *slot(0); }
+    const_reference front() const { return *slot(0); }
+    reference back() { return *slot(m_Size - 1); }
+    const_reference back() const { return *slot(m_Size - 1); }
+
+    // modifiers methods
+    void assign(size_type count, const value_type& val)
+    {
+        value_type copy(val);
+        clear();
+        resize(count, copy);
+    }
+
+    template <typename InputIterator>
+    typename enable_if<!is_integral<InputIterator>::value>::type
+    assign(InputIterator first, InputIterator last)
+    {
+        clear();
+        for (; first != last; ++first)
+        {
+            push_back(*first);
+        }
+    }
+
+    void push_back(const value_type& val)
+    {
+        if (m_Size == capacity())
+        {
+            add_block();
+        }
+        m_Allocator.construct(slot(m_Size), val); /// elements never move, so val stays valid
+        ++m_Size;
+    }
+
+    void pop_back()
+    {
+        --m_Size;
+        m_Allocator.destroy(slot(m_Size));
+    }
+
+    void swap(segmented_vector& x)
+    {
+        allocator_type tmp_alloc = m_Allocator;
+        size_type tmp_size = m_Size;
+
+        m_Allocator = x.m_Allocator;
+        m_Size = x.m_Size;
+
+        x.m_Allocator = tmp_alloc;
+        x.m_Size = tmp_size;
+
+        m_Directory.swap(x.m_Directory);
+    }
+
+    void clear() /// keeps the blocks for reuse
+    {
+        destroy_from(0);
+    }
+
+private:
+    pointer slot(size_type position) const
+    {
+        return m_Directory[position / BlockSize] + position % BlockSize;
+    }
+
+    void add_block()
+    {
+        pointer block = m_Allocator.allocate(BlockSize);
+        try
+        {
+            m_Directory.push_back(block);
+        }
+        catch (...)
+        {
+            m_Allocator.deallocate(block, BlockSize);
+            throw;
+        }
+    }
+
+    /// Destroys the elements and frees every block; on a throwing constructor the directory
+    /// member then frees itself.
+    void release_all()
+    {
+        clear();
+        release_blocks(0);
+    }
+
+    void release_blocks(size_type kept)
+    {
+        while (m_Directory.size() > kept)
+        {
+            m_Allocator.deallocate(m_Directory.back(), BlockSize);
+            m_Directory.pop_back();
+        }
+    }
+
+    void destroy_from(size_type new_size)
+    {
+        while (m_Size > new_size)
+        {
+            size_type block_begin = (m_Size - 1) / BlockSize * BlockSize;
+            size_type first = block_begin < new_size ? new_size : block_begin;
+            ft::destroy_n(m_Allocator, slot(first), m_Size - first);
+            m_Size = first;
+        }
+    }
+
+    void append_from(const segmented_vector& other)
+    {
+        reserve(other.m_Size);
+        for (size_type copied = 0; copied < other.m_Size; copied += BlockSize)
+        {
+            size_type count = other.m_Size - copied < BlockSize ? other.m_Size - copied : BlockSize;
+            ft::uninitialized_copy_n(m_Allocator, slot(copied), other.slot(copied), count);
+            m_Size = copied + count;
+        }
+    }
+};
+
+template <typename TType, std::size_t BlockSize, typename TAlloc>
+struct is_trivially_relocatable<segmented_vector<TType, BlockSize, TAlloc> > : is_trivially_relocatable<TAlloc>
+{};
+
+template <typename TType, std::size_t BlockSize, typename TAllocator>
+const std::size_t segmented_vector<TType, BlockSize, TAllocator>::block_size;
+
+template <typename TType, std::size_t BlockSize, typename TAlloc>
+void swap(segmented_vector<TType, BlockSize, TAlloc>& x, segmented_vector<TType, BlockSize, TAlloc>& y)
+{
+    x.swap(y);
+}
+
+template <typename TType, std::size_t BlockSize, typename TAlloc>
+bool operator==(const segmented_vector<TType, BlockSize, TAlloc>& lhs, const segmented_vector<TType, BlockSize, TAlloc>& rhs)
+{
+    return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename TType, std::size_t BlockSize, typename TAlloc>
+bool operator!=(const segmented_vector<TType, BlockSize, TAlloc>& lhs, const segmented_vector<TType, BlockSize, TAlloc>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename TType, std::size_t BlockSize, typename TAlloc>
+bool operator<(const segmented_vector<TType, BlockSize, TAlloc>& lhs, const segmented_vector<TType, BlockSize, TAlloc>& rhs)
+{
+    return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename TType, std::size_t BlockSize, typename TAlloc>
+bool operator>(const segmented_vector<TType, BlockSize, TAlloc>& lhs, const segmented_vector<TType, BlockSize, TAlloc>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename TType, std::size_t BlockSize, typename TAlloc>
+bool operator<=(const segmented_vector<TType, BlockSize, TAlloc>& lhs, const segmented_vector<TType, BlockSize, TAlloc>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename TType, std::size_t BlockSize, typename TAlloc>
+bool operator>=(const segmented_vector<TType, BlockSize, TAlloc>& lhs, const segmented_vector<TType, BlockSize, TAlloc>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+}
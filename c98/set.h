@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "rb_tree.h"
+#include "memory.h"
 #include "utility.h"
 #include "functional.h"
 
@@ -11,7 +12,8 @@ namespace ft
 
 template <class T,
           class Compare = ft::less<T>,
-          class Alloc = std::allocator<T>
+          class Alloc = std::allocator<T>,
+          bool Threaded = false
 >
 class set
 {
@@ -28,7 +30,7 @@ public:
     typedef typename allocator_type::const_pointer const_pointer;
 
 private:
-    typedef RbTree<key_type, value_type, key_compare, Identity<value_type>, allocator_type> rb_tree_type;
+    typedef RbTree<key_type, value_type, key_compare, Identity<value_type>, allocator_type, Threaded> rb_tree_type;
 
 public:
     typedef typename rb_tree_type::iterator iterator;
@@ -95,11 +97,6 @@ public:
 
     iterator insert(iterator position, const value_type& val)
     {
-        iterator found = find(val);
-        if (found != end())
-        {
-            return found;
-        }
         return iterator(&m_Tree, m_Tree.add(position, val));
     }
 
@@ -119,7 +116,7 @@ public:
 
     void erase(iterator position)
     {
-        m_Tree.deleteKey(*position);
+        m_Tree.deleteKey(position);
     }
 
     size_type erase(const value_type& val)
@@ -155,7 +152,7 @@ public:
 
     size_type count(const value_type& val) const
     {
-        return (m_Tree.find(val)) ? 1 : 0;
+        return m_Tree.count(val);
     }
 
     iterator lower_bound(const value_type& val) const
@@ -178,6 +175,9 @@ public:
         return allocator_type(m_Tree.get_allocator());
     }
 
+    template <typename U, typename C, typename A, bool Th, typename Predicate>
+    friend typename set<U, C, A, Th>::size_type erase_if(set<U, C, A, Th>& c, Predicate pred);
+
     friend bool operator==(const set& lhs, const set& rhs)
     {
         return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
@@ -189,32 +189,43 @@ public:
     }
 };
 
-template <typename T, typename Compare, typename Alloc>
-bool operator!=(const set<T, Compare, Alloc> &lhs, const set<T, Compare, Alloc> &rhs)
+template <typename T, typename Compare, typename Alloc, bool Threaded>
+struct is_trivially_relocatable<set<T, Compare, Alloc, Threaded> >
+    : bool_constant<is_trivially_relocatable<Compare>::value && is_trivially_relocatable<Alloc>::value>
+{};
+
+template <typename T, typename Compare, typename Alloc, bool Threaded>
+bool operator!=(const set<T, Compare, Alloc, Threaded> &lhs, const set<T, Compare, Alloc, Threaded> &rhs)
 {
     return !(lhs == rhs);
 }
 
-template <typename T, typename Compare, typename Alloc>
-bool operator>=(const set<T, Compare, Alloc> &lhs, const set<T, Compare, Alloc> &rhs)
+template <typename T, typename Compare, typename Alloc, bool Threaded>
+bool operator>=(const set<T, Compare, Alloc, Threaded> &lhs, const set<T, Compare, Alloc, Threaded> &rhs)
 {
     return !(lhs < rhs);
 }
 
-template <class T, class Compare, class Alloc>
-bool operator>(const set<T, Compare, Alloc> &lhs, const set<T, Compare, Alloc> &rhs)
+template <class T, class Compare, class Alloc, bool Threaded>
+bool operator>(const set<T, Compare, Alloc, Threaded> &lhs, const set<T, Compare, Alloc, Threaded> &rhs)
 {
     return rhs < lhs;
 }
 
-template <class T, class Compare, class Alloc>
-bool operator<=(const set<T, Compare, Alloc> &lhs, const set<T, Compare, Alloc> &rhs)
+template <class T, class Compare, class Alloc, bool Threaded>
+bool operator<=(const set<T, Compare, Alloc, Threaded> &lhs, const set<T, Compare, Alloc, Threaded> &rhs)
 {
     return !(rhs < lhs);
 }
 
-template <class T, class Compare, class Alloc>
-void swap(set<T, Compare, Alloc> &a, set<T, Compare, Alloc> &b)
+template <class T, class Compare, class Alloc, bool Threaded, class Predicate>
+typename set<T, Compare, Alloc, Threaded>::size_type erase_if(set<T, Compare, Alloc, Threaded>& c, Predicate pred)
+{
+    return c.m_Tree.erase_if(pred);
+}
+
+template <class T, class Compare, class Alloc, bool Threaded>
+void swap(set<T, Compare, Alloc, Threaded> &a, set<T, Compare, Alloc, Threaded> &b)
 {
     a.swap(b);
 }
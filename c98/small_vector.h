@@ -0,0 +1,466 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "iterator_traits.h"
+#include "random_access_iter.h"
+#include "reverse_iter.h"
+#include "algorithm.h"
+#include "growth_policy.h"
+#include "memory.h"
+
+namespace ft
+{
+
+/// vector that keeps up to InlineCapacity elements inside the object and spills to the heap beyond that
+template <typename TType, std::size_t InlineCapacity, typename TAllocator = std::allocator<TType> >
+class small_vector
+{
+public:
+    typedef TType value_type;
+    typedef TAllocator allocator_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename allocator_type::reference reference;
+    typedef const typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer pointer;
+    typedef typename allocator_type::const_pointer const_pointer;
+    typedef RandomAccessIterator<pointer, small_vector> iterator;
+    typedef RandomAccessIterator<const_pointer, small_vector> const_iterator;
+    typedef ReverseIterator<iterator> reverse_iterator;
+    typedef ReverseIterator<const_iterator> const_reverse_iterator;
+
+    static const size_type inline_capacity = InlineCapacity;
+
+private:
+    allocator_type m_Allocator;
+    size_type m_Size;
+    size_type m_Capacity;
+    pointer m_Data;
+    alignas(value_type) unsigned char m_Inline[InlineCapacity * sizeof(value_type)];
+
+public:
+    explicit small_vector(const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_Size(0)
+        , m_Capacity(InlineCapacity)
+        , m_Data(inline_data())
+    {}
+
+    explicit small_vector(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_Size(0)
+        , m_Capacity(InlineCapacity)
+        , m_Data(inline_data())
+    {
+        try
+        {
+            assign(count, value);
+        }
+        catch (...)
+        {
+            free_heap();
+            throw;
+        }
+    }
+
+    template <typename InputIterator>
+    small_vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+                 typename enable_if<!is_integral<InputIterator>::value>::type* = NULL)
+        : m_Allocator(alloc)
+        , m_Size(0)
+        , m_Capacity(InlineCapacity)
+        , m_Data(inline_data())
+    {
+        try
+        {
+            insert_range(0, first, last, ft::iterator_category(first));
+        }
+        catch (...)
+        {
+            free_heap(); /// a failed insert leaves no elements behind
+            throw;
+        }
+    }
+
+    small_vector(const small_vector& other)
+        : m_Allocator(other.m_Allocator)
+        , m_Size(0)
+        , m_Capacity(InlineCapacity)
+        , m_Data(inline_data())
+    {
+        try
+        {
+            reserve(other.m_Size);
+            ft::uninitialized_copy_n(m_Allocator, m_Data, other.m_Data, other.m_Size);
+        }
+        catch (...)
+        {
+            free_heap();
+            throw;
+        }
+        m_Size = other.m_Size;
+    }
+
+    small_vector& operator=(const small_vector& other)
+    {
+        if (&other != this)
+        {
+            clear();
+            reserve(other.m_Size);
+            ft::uninitialized_copy_n(m_Allocator, m_Data, other.m_Data, other.m_Size);
+            m_Size = other.m_Size;
+        }
+        return *this;
+    }
+
+    ~small_vector()
+    {
+        clear();
+        free_heap();
+    }
+
+    allocator_type get_allocator() const
+    {
+        return m_Allocator;
+    }
+
+    // iterator methods
+    iterator begin() { return iterator(m_Data); }
+    const_iterator begin() const { return const_iterator(m_Data); }
+    iterator end() { return iterator(m_Data + m_Size); }
+    const_iterator end() const { return const_iterator(m_Data + m_Size); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    const_iterator cbegin() const { return const_iterator(m_Data); }
+    const_iterator cend() const { return const_iterator(m_Data + m_Size); }
+    const_reverse_iterator crbegin() const { return reverse_iterator(cend()); }
+    const_reverse_iterator crend() const { return reverse_iterator(cbegin()); }
+
+    // capacity methods
+    size_type size() const { return m_Size; }
+    size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(value_type); }
+    size_type capacity() const { return m_Capacity; }
+    bool empty() const { return m_Size == 0; }
+    bool is_inline() const { return m_Data == inline_data(); }
+
+    void resize(size_type new_size, value_type val = value_type())
+    {
+        if (new_size > m_Size)
+        {
+            insert(end(), new_size - m_Size, val);
+        }
+        else
+        {
+            ft::destroy_n(m_Allocator, m_Data + new_size, m_Size - new_size);
+            m_Size = new_size;
+        }
+    }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity > max_size())
+        {
+            throw std::length_error("reserve of small_vector: new capacity is too much");
+        }
+        if (new_capacity > m_Capacity)
+        {
+            pointer new_data = relocate_storage(new_capacity, bool_constant<is_trivially_relocatable<value_type>::value>());
+            free_heap();
+            m_Data = new_data;
+            m_Capacity = new_capacity;
+        }
+    }
+
+    // element access methods
+    reference operator[](size_type position) { return m_Data[position]; }
+    const_reference operator[](size_type position) const { return m_Data[position]; }
+
+    reference at(size_type position)
+    {
+        if (position >= size())
+        {
+            throw std::out_of_range("out of range of small_vector");
+        }
+        return m_Data[position];
+    }
+
+    const_reference at(size_type position) const
+    {
+        if (position >= size())
+        {
+            throw std::out_of_range("out of range of small_vector");
+        }
+        return m_Data[position];
+    }
+
+    reference front() { return *begin(); }
+    const_reference front() const { return *begin(); }
+    reference back() { return *(end() - 1); }
+    const_reference back() const { return *(end() - 1); }
+
+    // modifiers methods
+    void assign(size_type count, const value_type& val)
+    {
+        value_type copy(val); /// val may be one of our elements
+        clear();
+        insert(end(), count, copy);
+    }
+
+    template <typename InputIterator>
+    typename enable_if<!is_integral<InputIterator>::value>::type
+    assign(InputIterator first, InputIterator last)
+    {
+        clear();
+        insert_range(0, first, last, ft::iterator_category(first));
+    }
+
+    void push_back(const value_type& val)
+    {
+        if (m_Size == m_Capacity)
+        {
+            value_type copy(val);
+            reserve(recommend(m_Size + 1));
+            m_Allocator.construct(m_Data + m_Size, copy);
+        }
+        else
+        {
+            m_Allocator.construct(m_Data + m_Size, val);
+        }
+        ++m_Size;
+    }
+
+    void pop_back()
+    {
+        --m_Size;
+        m_Allocator.destroy(m_Data + m_Size);
+    }
+
+    iterator insert(iterator position, const value_type& val)
+    {
+        size_type inserting_idx = position - begin();
+        insert(position, 1, val);
+        return begin() + inserting_idx;
+    }
+
+    void insert(iterator position, size_type inserted_cnt, const value_type& val)
+    {
+        value_type copy(val); /// val may move during the shift
+        size_type inserting_idx = position - begin();
+        reserve_for(inserted_cnt);
+        ft::insert_gap_n(m_Allocator, m_Data, m_Size, inserting_idx, inserted_cnt, fill_builder<allocator_type, value_type>(m_Allocator, copy));
+    }
+
+    template <typename InputIterator>
+    typename enable_if<!is_integral<InputIterator>::value>::type
+    insert(iterator position, InputIterator first, InputIterator last)
+    {
+        insert_range(position - begin(), first, last, ft::iterator_category(first));
+    }
+
+    iterator erase(iterator position)
+    {
+        return erase(position, position + 1);
+    }
+
+    iterator erase(iterator first, iterator last)
+    {
+        size_type start_idx = first - begin();
+        size_type end_idx = last - begin();
+
+        ft::destroy_n(m_Allocator, m_Data + start_idx, end_idx - start_idx);
+        ft::shift_n(m_Allocator, m_Data, m_Size, start_idx, end_idx, m_Size - end_idx); /// a throwing copy cuts m_Size to the intact prefix
+        m_Size -= end_idx - start_idx;
+        return begin() + start_idx;
+    }
+
+    void swap(small_vector& x)
+    {
+        if (&x == this)
+        {
+            return;
+        }
+        if (!is_inline() && !x.is_inline())
+        {
+            swap_heap(x);
+        }
+        else if (!is_inline())
+        {
+            x.take_heap(*this);
+        }
+        else if (!x.is_inline())
+        {
+            take_heap(x);
+        }
+        else
+        {
+            swap_inline(x);
+        }
+    }
+
+    void clear()
+    {
+        ft::destroy_n(m_Allocator, m_Data, m_Size);
+        m_Size = 0;
+    }
+
+private:
+    pointer inline_data() { return reinterpret_cast<pointer>(m_Inline); }
+    const_pointer inline_data() const { return reinterpret_cast<const_pointer>(m_Inline); }
+
+    size_type recommend(size_type new_size) const
+    {
+        if (new_size > max_size())
+        {
+            throw std::length_error("small_vector: new size is too much");
+        }
+        size_type new_capacity = growth_doubling::next_capacity(m_Capacity, new_size, sizeof(value_type));
+        return new_capacity > max_size() ? max_size() : new_capacity;
+    }
+
+    void reserve_for(size_type count)
+    {
+        if (m_Size + count > m_Capacity)
+        {
+            reserve(recommend(m_Size + count));
+        }
+    }
+
+    template <typename InputIterator>
+    void insert_range(size_type inserting_idx, InputIterator first, InputIterator last, input_iterator_tag)
+    {
+        small_vector buffered(m_Allocator); /// the count is unknown until the range is consumed
+        for (; first != last; ++first)
+        {
+            buffered.push_back(*first);
+        }
+        insert_range(inserting_idx, buffered.begin(), buffered.end(), forward_iterator_tag());
+    }
+
+    template <typename ForwardIterator>
+    void insert_range(size_type inserting_idx, ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+    {
+        size_type inserted_cnt = ft::distance(first, last);
+        reserve_for(inserted_cnt);
+        ft::insert_gap_n(m_Allocator, m_Data, m_Size, inserting_idx, inserted_cnt, copy_builder<allocator_type, ForwardIterator>(m_Allocator, first));
+    }
+
+    pointer relocate_storage(size_type new_capacity, true_type)
+    {
+        pointer new_data = m_Allocator.allocate(new_capacity);
+        ft::uninitialized_relocate_n(m_Allocator, new_data, m_Data, m_Size);
+        return new_data;
+    }
+
+    pointer relocate_storage(size_type new_capacity, false_type) /// copies first, destroys the old elements only once all copies exist
+    {
+        storage_guard<allocator_type> storage(m_Allocator, new_capacity);
+        ft::uninitialized_copy_n(m_Allocator, storage.get(), m_Data, m_Size);
+        ft::destroy_n(m_Allocator, m_Data, m_Size);
+        return storage.release();
+    }
+
+    void free_heap()
+    {
+        if (!is_inline())
+        {
+            m_Allocator.deallocate(m_Data, m_Capacity);
+        }
+    }
+
+    void swap_heap(small_vector& x)
+    {
+        pointer tmp_data = m_Data;
+        size_type tmp_size = m_Size;
+        size_type tmp_capacity = m_Capacity;
+
+        m_Data = x.m_Data;
+        m_Size = x.m_Size;
+        m_Capacity = x.m_Capacity;
+
+        x.m_Data = tmp_data;
+        x.m_Size = tmp_size;
+        x.m_Capacity = tmp_capacity;
+    }
+
+    /// this is inline, x is on the heap: our elements move into x's inline buffer, x's heap block becomes ours
+    void take_heap(small_vector& x)
+    {
+        pointer heap_data = x.m_Data;
+        size_type heap_size = x.m_Size;
+        size_type heap_capacity = x.m_Capacity;
+
+        ft::transfer_n(m_Allocator, x.inline_data(), m_Data, m_Size);
+        x.m_Data = x.inline_data();
+        x.m_Size = m_Size;
+        x.m_Capacity = InlineCapacity;
+
+        m_Data = heap_data;
+        m_Size = heap_size;
+        m_Capacity = heap_capacity;
+    }
+
+    void swap_inline(small_vector& x)
+    {
+        ft::swap_buffers(m_Allocator, m_Data, m_Size, x.m_Data, x.m_Size);
+    }
+};
+
+template <typename TType, std::size_t InlineCapacity, typename TAlloc>
+const typename small_vector<TType, InlineCapacity, TAlloc>::size_type small_vector<TType, InlineCapacity, TAlloc>::inline_capacity;
+
+template <typename TType, std::size_t InlineCapacity, typename TAlloc>
+void swap(small_vector<TType, InlineCapacity, TAlloc>& x, small_vector<TType, InlineCapacity, TAlloc>& y)
+{
+    x.swap(y);
+}
+
+template <typename TType, std::size_t InlineCapacity, typename TAlloc, typename Predicate>
+typename small_vector<TType, InlineCapacity, TAlloc>::size_type erase_if(small_vector<TType, InlineCapacity, TAlloc>& c, Predicate pred)
+{
+    return ft::erase_if_compact(c, pred);
+}
+
+template <typename TType, std::size_t InlineCapacity, typename TAlloc>
+bool operator==(const small_vector<TType, InlineCapacity, TAlloc>& lhs, const small_vector<TType, InlineCapacity, TAlloc>& rhs)
+{
+    return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename TType, std::size_t InlineCapacity, typename TAlloc>
+bool operator!=(const small_vector<TType, InlineCapacity, TAlloc>& lhs, const small_vector<TType, InlineCapacity, TAlloc>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename TType, std::size_t InlineCapacity, typename TAlloc>
+bool operator<(const small_vector<TType, InlineCapacity, TAlloc>& lhs, const small_vector<TType, InlineCapacity, TAlloc>& rhs)
+{
+    return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename TType, std::size_t InlineCapacity, typename TAlloc>
+bool operator>(const small_vector<TType, InlineCapacity, TAlloc>& lhs, const small_vector<TType, InlineCapacity, TAlloc>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename TType, std::size_t InlineCapacity, typename TAlloc>
+bool operator<=(const small_vector<TType, InlineCapacity, TAlloc>& lhs, const small_vector<TType, InlineCapacity, TAlloc>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename TType, std::size_t InlineCapacity, typename TAlloc>
+bool operator>=(const small_vector<TType, InlineCapacity, TAlloc>& lhs, const small_vector<TType, InlineCapacity, TAlloc>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+}
@@ -1,11 +1,11 @@
 #pragma once
 
-#include "vector.h"
+#include "deque.h"
 
 namespace ft
 {
 
-template <typename TType, typename TContainer = vector<TType> >
+template <typename TType, typename TContainer = deque<TType> >
 class stack
 {
 public:
@@ -0,0 +1,363 @@
+#pragma once
+
+#include <cassert>
+#include <stdexcept>
+
+#include "iterator_traits.h"
+#include "random_access_iter.h"
+#include "reverse_iter.h"
+#include "algorithm.h"
+#include "memory.h"
+
+namespace ft
+{
+
+/// Bounds policies for static_vector
+struct static_vector_throw
+{
+    static void capacity_exceeded() { throw std::length_error("static_vector: capacity exceeded"); }
+    static void out_of_range() { throw std::out_of_range("out of range of static_vector"); }
+};
+
+struct static_vector_assert /// unchecked when NDEBUG is defined
+{
+    static void capacity_exceeded() { assert(!"static_vector: capacity exceeded"); }
+    static void out_of_range() { assert(!"out of range of static_vector"); }
+};
+
+/// Element storage. For trivially copyable TType copying is left to the compiler,
+/// which keeps static_vector itself trivially copyable.
+template <typename TType, std::size_t Capacity, bool Trivial = is_trivially_copyable<TType>::value>
+class StaticVectorStorage : protected placement_construct<TType>
+{
+protected:
+    std::size_t m_Size;
+    alignas(TType) unsigned char m_Buffer[Capacity * sizeof(TType)];
+
+    StaticVectorStorage() : m_Size(0) {}
+
+    TType* storage() { return reinterpret_cast<TType*>(m_Buffer); }
+    const TType* storage() const { return reinterpret_cast<const TType*>(m_Buffer); }
+    placement_construct<TType>& constructor() { return *this; }
+};
+
+template <typename TType, std::size_t Capacity>
+class StaticVectorStorage<TType, Capacity, false> : protected placement_construct<TType>
+{
+protected:
+    std::size_t m_Size;
+    alignas(TType) unsigned char m_Buffer[Capacity * sizeof(TType)];
+
+    StaticVectorStorage() : m_Size(0) {}
+
+    StaticVectorStorage(const StaticVectorStorage& other)
+        : m_Size(0)
+    {
+        ft::uninitialized_copy_n(constructor(), storage(), other.storage(), other.m_Size);
+        m_Size = other.m_Size;
+    }
+
+    StaticVectorStorage& operator=(const StaticVectorStorage& other)
+    {
+        if (&other != this)
+        {
+            ft::destroy_n(constructor(), storage(), m_Size);
+            m_Size = 0;
+            ft::uninitialized_copy_n(constructor(), storage(), other.storage(), other.m_Size);
+            m_Size = other.m_Size;
+        }
+        return *this;
+    }
+
+    ~StaticVectorStorage()
+    {
+        ft::destroy_n(constructor(), storage(), m_Size);
+    }
+
+    TType* storage() { return reinterpret_cast<TType*>(m_Buffer); }
+    const TType* storage() const { return reinterpret_cast<const TType*>(m_Buffer); }
+    placement_construct<TType>& constructor() { return *this; }
+};
+
+/// vector with a fixed capacity on inline storage, never allocates
+template <typename TType, std::size_t Capacity, typename TBounds = static_vector_throw>
+class static_vector : private StaticVectorStorage<TType, Capacity>
+{
+    typedef StaticVectorStorage<TType, Capacity> base_type;
+
+public:
+    typedef TType value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef RandomAccessIterator<pointer, static_vector> iterator;
+    typedef RandomAccessIterator<const_pointer, static_vector> const_iterator;
+    typedef ReverseIterator<iterator> reverse_iterator;
+    typedef ReverseIterator<const_iterator> const_reverse_iterator;
+
+private:
+    using base_type::m_Size;
+    using base_type::storage;
+    using base_type::constructor;
+
+public:
+    static_vector() {}
+
+    explicit static_vector(size_type count, const value_type& value = value_type())
+    {
+        insert(end(), count, value);
+    }
+
+    template <typename InputIterator>
+    static_vector(InputIterator first, InputIterator last,
+                  typename enable_if<!is_integral<InputIterator>::value>::type* = NULL)
+    {
+        insert_range(0, first, last, ft::iterator_category(first));
+    }
+
+    // iterator methods
+    iterator begin() { return iterator(storage()); }
+    const_iterator begin() const { return const_iterator(storage()); }
+    iterator end() { return iterator(storage() + m_Size); }
+    const_iterator end() const { return const_iterator(storage() + m_Size); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    // capacity methods
+    size_type size() const { return m_Size; }
+    size_type max_size() const { return Capacity; }
+    size_type capacity() const { return Capacity; }
+    bool empty() const { return m_Size == 0; }
+    bool full() const { return m_Size == Capacity; }
+
+    void resize(size_type new_size, value_type val = value_type())
+    {
+        if (new_size > m_Size)
+        {
+            insert(end(), new_size - m_Size, val);
+        }
+        else
+        {
+            ft::destroy_n(constructor(), storage() + new_size, m_Size - new_size);
+            m_Size = new_size;
+        }
+    }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity > Capacity)
+        {
+            TBounds::capacity_exceeded();
+        }
+    }
+
+    // element access methods
+    reference operator[](size_type position) { return storage()[position]; }
+    const_reference operator[](size_type position) const { return storage()[position]; }
+
+    reference at(size_type position)
+    {
+        if (position >= m_Size)
+        {
+            TBounds::out_of_range();
+        }
+        return storage()[position];
+    }
+
+    const_reference at(size_type position) const
+    {
+        if (position >= m_Size)
+        {
+            TBounds::out_of_range();
+        }
+        return storage()[position];
+    }
+
+    reference front() { return *begin(); }
+    const_reference front() const { return *begin(); }
+    reference back() { return *(end() - 1); }
+    const_reference back() const { return *(end() - 1); }
+
+    pointer data() { return storage(); }
+    const_pointer data() const { return storage(); }
+
+    // modifiers methods
+    void assign(size_type count, const value_type& val)
+    {
+        value_type copy(val); /// val may be one of our elements
+        clear();
+        insert(end(), count, copy);
+    }
+
+    template <typename InputIterator>
+    typename enable_if<!is_integral<InputIterator>::value>::type
+    assign(InputIterator first, InputIterator last)
+    {
+        clear();
+        insert_range(0, first, last, ft::iterator_category(first));
+    }
+
+    void push_back(const value_type& val)
+    {
+        if (full())
+        {
+            TBounds::capacity_exceeded();
+        }
+        constructor().construct(storage() + m_Size, val);
+        ++m_Size;
+    }
+
+    void pop_back()
+    {
+        --m_Size;
+        constructor().destroy(storage() + m_Size);
+    }
+
+    iterator insert(iterator position, const value_type& val)
+    {
+        size_type inserting_idx = position - begin();
+        insert(position, 1, val);
+        return begin() + inserting_idx;
+    }
+
+    void insert(iterator position, size_type inserted_cnt, const value_type& val)
+    {
+        value_type copy(val); /// val may move during the shift
+        size_type inserting_idx = position - begin();
+        check_room(inserted_cnt);
+        ft::insert_gap_n(constructor(), storage(), m_Size, inserting_idx, inserted_cnt,
+                         fill_builder<placement_construct<TType>, value_type>(constructor(), copy));
+    }
+
+    template <typename InputIterator>
+    typename enable_if<!is_integral<InputIterator>::value>::type
+    insert(iterator position, InputIterator first, InputIterator last)
+    {
+        insert_range(position - begin(), first, last, ft::iterator_category(first));
+    }
+
+    iterator erase(iterator position)
+    {
+        return erase(position, position + 1);
+    }
+
+    iterator erase(iterator first, iterator last)
+    {
+        size_type start_idx = first - begin();
+        size_type end_idx = last - begin();
+
+        ft::destroy_n(constructor(), storage() + start_idx, end_idx - start_idx);
+        ft::shift_n(constructor(), storage(), m_Size, start_idx, end_idx, m_Size - end_idx);
+        m_Size -= end_idx - start_idx;
+        return begin() + start_idx;
+    }
+
+    void swap(static_vector& x)
+    {
+        if (&x == this)
+        {
+            return;
+        }
+        ft::swap_buffers(constructor(), storage(), m_Size, x.storage(), x.m_Size);
+    }
+
+    void clear()
+    {
+        ft::destroy_n(constructor(), storage(), m_Size);
+        m_Size = 0;
+    }
+
+private:
+    void check_room(size_type count)
+    {
+        if (count > Capacity - m_Size)
+        {
+            TBounds::capacity_exceeded();
+        }
+    }
+
+    template <typename InputIterator>
+    void insert_range(size_type inserting_idx, InputIterator first, InputIterator last, input_iterator_tag)
+    {
+        static_vector buffered; /// the count is unknown until the range is consumed
+        for (; first != last; ++first)
+        {
+            buffered.push_back(*first);
+        }
+        insert_range(inserting_idx, buffered.begin(), buffered.end(), forward_iterator_tag());
+    }
+
+    template <typename ForwardIterator>
+    void insert_range(size_type inserting_idx, ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+    {
+        size_type inserted_cnt = ft::distance(first, last);
+        check_room(inserted_cnt);
+        ft::insert_gap_n(constructor(), storage(), m_Size, inserting_idx, inserted_cnt,
+                         copy_builder<placement_construct<TType>, ForwardIterator>(constructor(), first));
+    }
+};
+
+template <typename TType, std::size_t Capacity, typename TBounds>
+struct is_trivially_relocatable<static_vector<TType, Capacity, TBounds> > : is_trivially_relocatable<TType> /// elements are inline
+{};
+
+template <typename TType, std::size_t Capacity, typename TBounds>
+void swap(static_vector<TType, Capacity, TBounds>& x, static_vector<TType, Capacity, TBounds>& y)
+{
+    x.swap(y);
+}
+
+template <typename TType, std::size_t Capacity, typename TBounds, typename Predicate>
+typename static_vector<TType, Capacity, TBounds>::size_type erase_if(static_vector<TType, Capacity, TBounds>& c, Predicate pred)
+{
+    return ft::erase_if_compact(c, pred);
+}
+
+template <typename TType, std::size_t Capacity, typename TBounds>
+bool operator==(const static_vector<TType, Capacity, TBounds>& lhs, const static_vector<TType, Capacity, TBounds>& rhs)
+{
+    return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename TType, std::size_t Capacity, typename TBounds>
+bool operator!=(const static_vector<TType, Capacity, TBounds>& lhs, const static_vector<TType, Capacity, TBounds>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename TType, std::size_t Capacity, typename TBounds>
+bool operator<(const static_vector<TType, Capacity, TBounds>& lhs, const static_vector<TType, Capacity, TBounds>& rhs)
+{
+    return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename TType, std::size_t Capacity, typename TBounds>
+bool operator>(const static_vector<TType, Capacity, TBounds>& lhs, const static_vector<TType, Capacity, TBounds>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename TType, std::size_t Capacity, typename TBounds>
+bool operator<=(const static_vector<TType, Capacity, TBounds>& lhs, const static_vector<TType, Capacity, TBounds>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename TType, std::size_t Capacity, typename TBounds>
+bool operator>=(const static_vector<TType, Capacity, TBounds>& lhs, const static_vector<TType, Capacity, TBounds>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+}
@@ -19,6 +19,9 @@ struct bool_constant
     static const bool value = Val;
 };
 
+template <bool Val>
+const bool bool_constant<Val>::value;
+
 typedef bool_constant<true> true_type;
 typedef bool_constant<false> false_type;
 
@@ -100,7 +103,7 @@ private:
     template <typename F, typename = decltype(aux(declval<F>()))>
     static true_type dummy(void*);
 
-    template <typename, typename>
+    template <typename>
     static false_type dummy(...);
 
 public:
@@ -156,6 +159,14 @@ template <typename T>
 struct is_integral : is_integral_helper<typename remove_cv<T>::type>
 {};
 
+template <typename T>
+struct is_trivially_copyable : bool_constant<__is_trivially_copyable(T)> /// compiler intrinsic, can't be expressed in the language itself
+{};
+
+template <typename T>
+struct is_trivially_default_constructible : bool_constant<__is_trivially_constructible(T)>
+{};
+
 template <bool Cond, typename True, typename False>
 struct conditional;
 
@@ -2,20 +2,26 @@
 
 #include <limits>
 #include <memory>
+#include <stdexcept>
 
 #include "random_access_iter.h"
 #include "reverse_iter.h"
 #include "algorithm.h"
+#include "allocator.h"
+#include "growth_policy.h"
+#include "memory.h"
+#include "type_traits.h"
 
 namespace ft
 {
 
-template <typename TType, typename TAllocator = std::allocator<TType> >
+template <typename TType, typename TAllocator = std::allocator<TType>, typename TGrowth = growth_doubling>
 class vector
 {
 public:
     typedef TType value_type;
     typedef TAllocator allocator_type;
+    typedef TGrowth growth_policy;
     typedef std::size_t size_type;
     typedef std::ptrdiff_t difference_type;
     typedef typename allocator_type::reference reference;
@@ -37,6 +43,9 @@ private:
     size_type m_Capacity;
     pointer m_Data;
 
+    typedef bool_constant<is_trivially_relocatable<value_type>::value> relocate_tag;
+    typedef bool_constant<relocate_tag::value && has_reallocate<allocator_type>::value> reallocate_tag;
+
 public:
     explicit vector(const allocator_type& alloc = allocator_type())
         : m_Allocator(alloc)
@@ -50,22 +59,20 @@ public:
         , m_Size(mem_size)
         , m_Capacity(mem_size)
     {
-        m_Data = m_Allocator.allocate(m_Capacity);
-        construct_elements(0, m_Size, m_Data, value);
+        storage_guard<allocator_type> storage(m_Allocator, m_Capacity);
+        ft::uninitialized_fill_n(m_Allocator, storage.get(), m_Size, value);
+        m_Data = storage.release();
     }
 
     template <typename InputIterator>
-    vector(InputIterator begin, InputIterator end, const allocator_type& alloc = allocator_type())
+    vector(InputIterator begin, InputIterator end, const allocator_type& alloc = allocator_type(),
+           typename enable_if<!is_integral<InputIterator>::value>::type* = NULL)
         : m_Allocator(alloc)
         , m_Size(0)
-        , m_Capacity(end - begin)
+        , m_Capacity(0)
+        , m_Data(NULL)
     {
-        m_Data = m_Allocator.allocate(m_Capacity);
-        while (begin != end)
-        {
-            push_back(*begin);
-            ++begin;
-        }
+        assign_range(begin, end, ft::iterator_category(begin));
     }
 
     vector(const vector& other)
@@ -73,21 +80,15 @@ public:
         , m_Size(other.m_Size)
         , m_Capacity(other.m_Capacity)
     {
-        m_Data = m_Allocator.allocate(m_Capacity);
-        for (size_type i = 0; i < other.m_Size; ++i)
-        {
-            m_Allocator.construct(m_Data + i, other[i]);
-        }
+        storage_guard<allocator_type> storage(m_Allocator, m_Capacity);
+        ft::uninitialized_copy_n(m_Allocator, storage.get(), other.m_Data, m_Size);
+        m_Data = storage.release();
     }
     vector& operator=(const vector& other)
     {
         if (&other != this)
         {
-            m_Allocator = other.m_Allocator;
-            for (size_type i = 0; i < other.m_Size; ++i)
-            {
-                push_back(other[i]);
-            }
+            assign_elements(other.m_Data, other.m_Size);
         }
         return *this;
     }
@@ -131,7 +132,10 @@ public:
         }
         if (new_size > capacity())
         {
-            reserve(capacity() * 2 * (new_size / capacity()));
+            reserve(recommend(new_size));
+        }
+        if (new_size > m_Size)
+        {
             construct_elements(m_Size, new_size, m_Data, val);
         }
         else
@@ -139,11 +143,64 @@ public:
             destroy_elements(new_size, m_Size);
         }
         m_Size = new_size;
+        shrink_if_sparse();
+    }
+
+    void resize_default_init(size_type new_size) /// like resize, but new trivial elements stay uninitialized
+    {
+        if (new_size > capacity())
+        {
+            reserve(recommend(new_size));
+        }
+        if (new_size > m_Size)
+        {
+            default_init_elements(m_Size, new_size, is_trivially_default_constructible<value_type>());
+        }
+        else
+        {
+            destroy_elements(new_size, m_Size);
+        }
+        m_Size = new_size;
+        shrink_if_sparse();
+    }
+
+    pointer append_uninitialized(size_type count) /// grows by count default-initialized elements and returns the first of them
+    {
+        size_type old_size = m_Size;
+        resize_default_init(m_Size + count);
+        return m_Data + old_size;
     }
 
     size_type capacity() const { return m_Capacity; }
     bool empty() const { return size() == 0; }
 
+    void shrink_to_fit()
+    {
+        shrink_to(m_Size);
+    }
+
+    void shrink_to(size_type new_capacity) /// lowers capacity to max(new_capacity, size()), never grows
+    {
+        if (new_capacity < m_Size)
+        {
+            new_capacity = m_Size;
+        }
+        if (new_capacity >= m_Capacity)
+        {
+            return;
+        }
+        if (new_capacity == 0)
+        {
+            m_Allocator.deallocate(m_Data, m_Capacity);
+            m_Data = NULL;
+        }
+        else
+        {
+            m_Data = move_storage(new_capacity, reallocate_tag());
+        }
+        m_Capacity = new_capacity;
+    }
+
     void reserve(size_type new_capacity) /// Only change capacity, saving old elements if it happens allocation
     {
         if (new_capacity > max_size())
@@ -152,16 +209,9 @@ public:
         }
         if (new_capacity > capacity())
         {
-            pointer new_data = m_Allocator.allocate(new_capacity);
-            construct_elements(0, m_Size, new_data, m_Data);
-
-            size_type saved_size = m_Size;
-            clear();
-            m_Allocator.deallocate(m_Data, m_Capacity);
-            m_Data = new_data;
-            m_Size = saved_size;
+            m_Data = move_storage(new_capacity, reallocate_tag());
+            m_Capacity = new_capacity;
         }
-        m_Capacity = new_capacity;
     }
 
     // element access methods
@@ -194,57 +244,46 @@ public:
     // modifiers methods
     void assign(size_type new_size, const value_type& val) /// change size, substituting all old elements to val
     {
-        if (!empty())
+        if (new_size > capacity())
         {
-            clear();
+            storage_guard<allocator_type> storage(m_Allocator, recommend(new_size));
+            ft::uninitialized_fill_n(m_Allocator, storage.get(), new_size, val); /// val may live in the old storage
+            replace_storage(storage);
         }
-        if (new_size > capacity())
+        else
         {
-            m_Allocator.deallocate(m_Data, m_Capacity);
-            m_Capacity *= 2 * (new_size / capacity());
-            m_Data = m_Allocator.allocate(capacity());
+            size_type common = new_size < m_Size ? new_size : m_Size;
+            for (size_type i = 0; i < common; ++i)
+            {
+                m_Data[i] = val;
+            }
+            construct_elements(common, new_size, m_Data, val);
+            destroy_elements(new_size, m_Size);
         }
-        construct_elements(0, new_size, m_Data, val);
         m_Size = new_size;
     }
 
     template <typename InputIterator>
-    typename enable_if<is_convertible<typename InputIterator::iterator_category, input_iterator_tag>::value>::type
+    typename enable_if<!is_integral<InputIterator>::value>::type
     assign(InputIterator begin, InputIterator end)
     {
-        if (!empty())
-        {
-            clear();
-        }
-        difference_type new_size = end - begin;
-        if (new_size > capacity())
-        {
-            m_Allocator.deallocate(m_Data, m_Capacity);
-            m_Capacity *= 2 * (new_size / capacity());
-            m_Data = m_Allocator.allocate(capacity());
-        }
-        while (begin != end)
-        {
-            push_back(*begin);
-            ++begin;
-        }
-        m_Size = new_size;
+        assign_range(begin, end, ft::iterator_category(begin));
     }
 
     void push_back(const value_type& val)
     {
+        const value_type* source = &val;
         if (size() == capacity())
         {
-            if (capacity() == 0)
+            bool own_element = source >= m_Data && source < m_Data + m_Size;
+            size_type source_idx = own_element ? source - m_Data : 0;
+            reserve(recommend(m_Size + 1));
+            if (own_element)
             {
-                reserve(1);
-            }
-            else
-            {
-                reserve(capacity() * 2);
+                source = m_Data + source_idx; /// val moved together with the elements
             }
         }
-        construct_elements(m_Size, m_Size + 1, m_Data, val);
+        construct_elements(m_Size, m_Size + 1, m_Data, *source);
         ++m_Size;
     }
 
@@ -252,6 +291,7 @@ public:
     {
         --m_Size;
         destroy_elements(m_Size, m_Size + 1);
+        shrink_if_sparse();
     }
 
     iterator insert(iterator position, const value_type& val)
@@ -269,91 +309,66 @@ public:
         size_type new_size = m_Size + inserted_cnt;
         if (new_size > m_Capacity)
         {
-            size_type new_capacity = m_Capacity ? m_Capacity * 2 * (new_size / m_Capacity) : new_size;
-            pointer new_data = m_Allocator.allocate(new_capacity);
-
-            construct_elements(0, inserting_idx, new_data, m_Data);
-            for (size_type i = 0; i < inserted_cnt; ++i)
-            {
-                m_Allocator.construct(new_data + inserting_idx + i, val);
-            }
-            for (size_type i = inserting_idx + inserted_cnt; i < new_size; ++i)
-            {
-                m_Allocator.construct(new_data + i, m_Data[i - inserted_cnt]);
-            }
-
-            clear();
-            m_Allocator.deallocate(m_Data, m_Capacity);
-            m_Data = new_data;
-            m_Capacity = new_capacity;
+            grow_around(inserting_idx, inserted_cnt, fill_gap(val), relocate_tag()); /// val may live in the old storage
+            m_Size = new_size;
         }
         else
         {
-            for (size_type i = m_Size - 1; i >= inserting_idx; --i)
-            {
-                m_Allocator.construct(m_Data + i + inserted_cnt, m_Data[i]);
-                m_Allocator.destroy(m_Data + i);
-            }
-            for (size_type i = 0; i < inserted_cnt; ++i)
+            const value_type* source = &val;
+            if (source >= m_Data + inserting_idx && source < m_Data + m_Size)
             {
-                m_Allocator.construct(m_Data + inserting_idx + i, val);
+                source += inserted_cnt; /// val is shifted together with the tail
             }
+            fill_gap gap(*source);
+            ft::insert_gap_n(m_Allocator, m_Data, m_Size, inserting_idx, inserted_cnt, owned_gap<fill_gap>(*this, gap));
         }
-        m_Size = new_size;
     }
 
     template <typename InputIterator>
-    typename enable_if<is_convertible<typename InputIterator::iterator_category, input_iterator_tag>::value>::type
+    typename enable_if<!is_integral<InputIterator>::value>::type
     insert(iterator position, InputIterator first, InputIterator last)
     {
-        size_type inserted_cnt = last - first;
-        size_type inserting_idx = position - begin();
-        size_type new_size = m_Size + inserted_cnt;
-        if (new_size > m_Capacity)
-        {
-            size_type new_capacity = m_Capacity ? m_Capacity * 2 * (new_size / m_Capacity) : new_size;
-            pointer new_data = m_Allocator.allocate(new_capacity);
+        insert_range(position - begin(), first, last, ft::iterator_category(first));
+    }
 
-            construct_elements(0, inserting_idx, new_data, m_Data);
-            for (size_type i = 0; i < inserted_cnt; ++i)
-            {
-                m_Allocator.construct(new_data + inserting_idx + i, *(first + i));
-            }
-            for (size_type i = inserting_idx + inserted_cnt; i < new_size; ++i)
-            {
-                m_Allocator.construct(new_data + i, m_Data[i - inserted_cnt]);
-            }
+    template <typename InputIterator>
+    typename enable_if<!is_integral<InputIterator>::value>::type
+    append(InputIterator first, InputIterator last) /// one capacity check and one size update for the whole range
+    {
+        append_range(first, last, ft::iterator_category(first));
+    }
 
-            clear();
-            m_Allocator.deallocate(m_Data, m_Capacity);
-            m_Data = new_data;
-            m_Capacity = new_capacity;
+    template <typename TGenerator>
+    void append_n(size_type count, TGenerator gen) /// appends gen() count times; on a throw the elements are kept, the capacity may have grown
+    {
+        if (m_Size + count > m_Capacity)
+        {
+            reserve(recommend(m_Size + count));
         }
-        else
+        pointer destination = m_Data + m_Size;
+        size_type i = 0;
+        try
         {
-            for (size_type i = m_Size - 1; i >= inserting_idx; --i)
-            {
-                m_Allocator.construct(m_Data + i + inserted_cnt, m_Data[i]);
-                m_Allocator.destroy(m_Data + i);
-            }
-            for (size_type i = 0; i < inserted_cnt; ++i)
+            for (; i < count; ++i)
             {
-                m_Allocator.construct(m_Data + inserting_idx + i, *(first + i));
+                m_Allocator.construct(destination + i, gen());
             }
         }
-        m_Size = new_size;
+        catch (...)
+        {
+            ft::destroy_n(m_Allocator, destination, i);
+            throw;
+        }
+        m_Size += count;
     }
 
     iterator erase(iterator position)
     {
         size_type erased_idx = position - begin();
         destroy_elements(erased_idx, erased_idx + 1);
-        for (size_type i = erased_idx + 1; i < m_Size; ++i)
-        {
-            m_Allocator.construct(m_Data + (i - 1), m_Data[i]);
-            m_Allocator.destroy(m_Data + i);
-        }
+        shift_elements(erased_idx, erased_idx + 1, m_Size - erased_idx - 1);
         --m_Size;
+        shrink_if_sparse();
         return begin() + erased_idx;
     }
 
@@ -363,12 +378,9 @@ public:
         size_type end_idx = last - begin();
 
         destroy_elements(start_idx, end_idx);
-        for (size_type i = end_idx; i < m_Size; ++i)
-        {
-            m_Allocator.construct(m_Data + start_idx + (i - end_idx), m_Data[i]);
-            m_Allocator.destroy(m_Data + i);
-        }
-        m_Size -= last - first;
+        shift_elements(start_idx, end_idx, m_Size - end_idx);
+        m_Size -= end_idx - start_idx;
+        shrink_if_sparse();
         return begin() + start_idx;
     }
 
@@ -402,78 +414,322 @@ public:
     }
 
 private:
-    void construct_elements(size_type begin_pos,
-                            size_type end_pos,
-                            pointer destination,
-                            const value_type& source)
+    size_type recommend(size_type new_size) const
     {
-        for (size_type i = begin_pos; i < end_pos; ++i)
+        if (new_size > max_size())
+        {
+            throw std::length_error("vector: new size is too much");
+        }
+        size_type new_capacity = growth_policy::next_capacity(m_Capacity, new_size, sizeof(value_type));
+        return new_capacity > max_size() ? max_size() : new_capacity;
+    }
+
+    template <typename InputIterator>
+    void assign_range(InputIterator first, InputIterator last, input_iterator_tag) /// single pass, grows as it goes
+    {
+        size_type assigned = 0;
+        for ( ; first != last && assigned < m_Size; ++first, ++assigned)
+        {
+            m_Data[assigned] = *first;
+        }
+        destroy_elements(assigned, m_Size);
+        m_Size = assigned;
+        for ( ; first != last; ++first)
+        {
+            push_back(*first);
+        }
+    }
+
+    template <typename ForwardIterator>
+    void assign_range(ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+    {
+        assign_elements(first, ft::distance(first, last));
+    }
+
+    template <typename InputIterator>
+    void append_range(InputIterator first, InputIterator last, input_iterator_tag) /// nothing to shift, so no buffering either
+    {
+        for ( ; first != last; ++first)
+        {
+            push_back(*first);
+        }
+    }
+
+    template <typename ForwardIterator>
+    void append_range(ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+    {
+        insert_range(m_Size, first, last, forward_iterator_tag());
+    }
+
+    template <typename InputIterator>
+    void insert_range(size_type inserting_idx, InputIterator first, InputIterator last, input_iterator_tag)
+    {
+        vector buffered(first, last, m_Allocator); /// the count is unknown until the range is consumed
+        insert_range(inserting_idx, buffered.m_Data, buffered.m_Data + buffered.m_Size, forward_iterator_tag());
+    }
+
+    template <typename ForwardIterator>
+    void insert_range(size_type inserting_idx, ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+    {
+        size_type inserted_cnt = ft::distance(first, last);
+        size_type new_size = m_Size + inserted_cnt;
+        if (new_size > m_Capacity)
+        {
+            grow_around(inserting_idx, inserted_cnt, copy_gap<ForwardIterator>(first), relocate_tag());
+            m_Size = new_size;
+        }
+        else
         {
-            m_Allocator.construct(destination + i, source);
+            copy_gap<ForwardIterator> gap(first);
+            ft::insert_gap_n(m_Allocator, m_Data, m_Size, inserting_idx, inserted_cnt, owned_gap<copy_gap<ForwardIterator> >(*this, gap));
         }
     }
 
+    /// Contiguous sources of our own value_type go through memcpy when it is trivially copyable
+    template <typename ForwardIterator>
+    void copy_construct(pointer destination, ForwardIterator first, size_type count)
+    {
+        ft::uninitialized_copy_range(m_Allocator, destination, first, count);
+    }
+
+    void copy_construct(pointer destination, pointer first, size_type count)
+    {
+        ft::uninitialized_copy_n(m_Allocator, destination, first, count);
+    }
+
+    void copy_construct(pointer destination, const_pointer first, size_type count)
+    {
+        ft::uninitialized_copy_n(m_Allocator, destination, first, count);
+    }
+
+    template <typename TIter, typename TContainer>
+    void copy_construct(pointer destination, RandomAccessIterator<TIter, TContainer> first, size_type count)
+    {
+        copy_construct(destination, first.operator->(), count);
+    }
+
+    /// Assigns over live elements and constructs/destroys only the difference;
+    /// allocates once if count exceeds capacity
+    template <typename InputIterator>
+    void assign_elements(InputIterator first, size_type count)
+    {
+        if (count > capacity())
+        {
+            storage_guard<allocator_type> storage(m_Allocator, recommend(count));
+            copy_construct(storage.get(), first, count);
+            replace_storage(storage);
+        }
+        else
+        {
+            size_type common = count < m_Size ? count : m_Size;
+            for (size_type i = 0; i < common; ++i, ++first)
+            {
+                m_Data[i] = *first;
+            }
+            if (count > m_Size)
+            {
+                copy_construct(m_Data + common, first, count - common);
+            }
+            destroy_elements(count, m_Size);
+        }
+        m_Size = count;
+    }
+
+    void replace_storage(storage_guard<allocator_type>& storage) /// callers set m_Size afterwards
+    {
+        clear();
+        m_Allocator.deallocate(m_Data, m_Capacity);
+        m_Capacity = storage.capacity();
+        m_Data = storage.release();
+    }
+
+    /// Gap builders for grow_around, and through owned_gap for ft::insert_gap_n
+    struct fill_gap
+    {
+        const value_type& m_Value;
+
+        explicit fill_gap(const value_type& val) : m_Value(val) {}
+        void operator()(vector& owner, pointer destination, size_type count) const
+        {
+            ft::uninitialized_fill_n(owner.m_Allocator, destination, count, m_Value);
+        }
+    };
+
+    template <typename ForwardIterator>
+    struct copy_gap
+    {
+        ForwardIterator m_First;
+
+        explicit copy_gap(ForwardIterator first) : m_First(first) {}
+        void operator()(vector& owner, pointer destination, size_type count) const
+        {
+            owner.copy_construct(destination, m_First, count);
+        }
+    };
+
+    template <typename TBuildGap>
+    struct owned_gap
+    {
+        vector& m_Owner;
+        const TBuildGap& m_BuildGap;
+
+        owned_gap(vector& owner, const TBuildGap& build_gap) : m_Owner(owner), m_BuildGap(build_gap) {}
+        void operator()(pointer destination, size_type count) const
+        {
+            m_BuildGap(m_Owner, destination, count);
+        }
+    };
+
+    /// Moves to a buffer with room for count more elements at position, which build_gap fills.
+    /// Copying types copy everything before the old elements die.
+    template <typename TBuildGap>
+    void grow_around(size_type position, size_type count, const TBuildGap& build_gap, false_type)
+    {
+        storage_guard<allocator_type> storage(m_Allocator, recommend(m_Size + count));
+        ft::uninitialized_copy_n(m_Allocator, storage.get(), m_Data, position);
+        storage.built(position);
+        build_gap(*this, storage.get() + position, count);
+        storage.built(count);
+        ft::uninitialized_copy_n(m_Allocator, storage.get() + position + count, m_Data + position, m_Size - position);
+        replace_storage(storage);
+    }
+
+    /// Relocatable types build the gap first; the memcpy of the old elements afterwards cannot fail
+    template <typename TBuildGap>
+    void grow_around(size_type position, size_type count, const TBuildGap& build_gap, true_type)
+    {
+        storage_guard<allocator_type> storage(m_Allocator, recommend(m_Size + count));
+        build_gap(*this, storage.get() + position, count);
+        ft::uninitialized_relocate_n(m_Allocator, storage.get(), m_Data, position);
+        ft::uninitialized_relocate_n(m_Allocator, storage.get() + position + count, m_Data + position, m_Size - position);
+        m_Allocator.deallocate(m_Data, m_Capacity);
+        m_Capacity = storage.capacity();
+        m_Data = storage.release();
+    }
+
+    void shrink_if_sparse()
+    {
+        size_type new_capacity = growth_policy::shrink_capacity(m_Size, m_Capacity);
+        if (new_capacity < m_Capacity)
+        {
+            shrink_to(new_capacity);
+        }
+    }
+
+    pointer move_storage(size_type new_capacity, true_type)
+    {
+        return m_Allocator.reallocate(m_Data, m_Capacity, new_capacity);
+    }
+
+    pointer move_storage(size_type new_capacity, false_type)
+    {
+        return relocate_storage(new_capacity, relocate_tag());
+    }
+
+    pointer relocate_storage(size_type new_capacity, true_type)
+    {
+        pointer new_data = m_Allocator.allocate(new_capacity);
+        ft::uninitialized_relocate_n(m_Allocator, new_data, m_Data, m_Size);
+        m_Allocator.deallocate(m_Data, m_Capacity);
+        return new_data;
+    }
+
+    pointer relocate_storage(size_type new_capacity, false_type) /// copies first, frees the old elements only once all copies exist
+    {
+        storage_guard<allocator_type> storage(m_Allocator, new_capacity);
+        ft::uninitialized_copy_n(m_Allocator, storage.get(), m_Data, m_Size);
+        destroy_elements(0, m_Size);
+        m_Allocator.deallocate(m_Data, m_Capacity);
+        return storage.release();
+    }
+
+    /// Relocates count elements inside the buffer; a throwing copy leaves the intact prefix
+    void shift_elements(size_type destination, size_type source, size_type count)
+    {
+        ft::shift_n(m_Allocator, m_Data, m_Size, destination, source, count);
+    }
+
     void construct_elements(size_type begin_pos,
                             size_type end_pos,
                             pointer destination,
-                            pointer source)
+                            const value_type& source)
+    {
+        ft::uninitialized_fill_n(m_Allocator, destination + begin_pos, end_pos - begin_pos, source);
+    }
+
+    void default_init_elements(size_type, size_type, true_type)
+    {}
+
+    void default_init_elements(size_type begin_pos, size_type end_pos, false_type)
     {
         for (size_type i = begin_pos; i < end_pos; ++i)
         {
-            m_Allocator.construct(destination + i, source[i]);
+            ::new (static_cast<void*>(m_Data + i)) value_type;
         }
     }
 
     void destroy_elements(size_type begin_pos, size_type end_pos)
     {
-        for (size_type i = begin_pos; i < end_pos; ++ i)
+        if (begin_pos < end_pos)
         {
-            m_Allocator.destroy(m_Data + i);
+            ft::destroy_n(m_Allocator, m_Data + begin_pos, end_pos - begin_pos);
         }
     }
 };
 
+template <typename TType, typename TAlloc, typename TGrowth>
+struct is_trivially_relocatable<vector<TType, TAlloc, TGrowth> > : is_trivially_relocatable<TAlloc> /// only the buffer pointer refers to the elements
+{};
 
-template <class TType, class TAlloc>
-void swap(vector<TType, TAlloc>& x, vector<TType, TAlloc>& y)
+
+template <class TType, class TAlloc, class TGrowth>
+void swap(vector<TType, TAlloc, TGrowth>& x, vector<TType, TAlloc, TGrowth>& y)
 {
     x.swap(y);
 }
 
-template <typename TType, typename TAlloc>
-bool operator==(const vector<TType,TAlloc>& lhs, const vector<TType,TAlloc>& rhs)
+template <class TType, class TAlloc, class TGrowth, class Predicate>
+typename vector<TType, TAlloc, TGrowth>::size_type erase_if(vector<TType, TAlloc, TGrowth>& c, Predicate pred)
+{
+    return ft::erase_if_compact(c, pred);
+}
+
+template <typename TType, typename TAlloc, typename TGrowth>
+bool operator==(const vector<TType, TAlloc, TGrowth>& lhs, const vector<TType, TAlloc, TGrowth>& rhs)
 {
     return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <typename TType, typename TAlloc>
-bool operator!=(const vector<TType,TAlloc>& lhs, const vector<TType,TAlloc>& rhs)
+template <typename TType, typename TAlloc, typename TGrowth>
+bool operator!=(const vector<TType, TAlloc, TGrowth>& lhs, const vector<TType, TAlloc, TGrowth>& rhs)
 {
     return !(lhs == rhs);
 }
 
-template <typename TType, typename TAlloc>
-bool operator<(const vector<TType,TAlloc>& lhs, const vector<TType,TAlloc>& rhs)
+template <typename TType, typename TAlloc, typename TGrowth>
+bool operator<(const vector<TType, TAlloc, TGrowth>& lhs, const vector<TType, TAlloc, TGrowth>& rhs)
 {
     return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <typename TType, typename TAlloc>
-bool operator>(const vector<TType,TAlloc>& lhs, const vector<TType,TAlloc>& rhs)
+template <typename TType, typename TAlloc, typename TGrowth>
+bool operator>(const vector<TType, TAlloc, TGrowth>& lhs, const vector<TType, TAlloc, TGrowth>& rhs)
 {
     return rhs < lhs;
 }
 
-template <typename TType, typename TAlloc>
-bool operator<=(const vector<TType,TAlloc>& lhs, const vector<TType,TAlloc>& rhs)
+template <typename TType, typename TAlloc, typename TGrowth>
+bool operator<=(const vector<TType, TAlloc, TGrowth>& lhs, const vector<TType, TAlloc, TGrowth>& rhs)
 {
     return !(rhs < lhs);
 }
 
-template <typename TType, typename TAlloc>
-bool operator>=(const vector<TType,TAlloc>& lhs, const vector<TType,TAlloc>& rhs)
+template <typename TType, typename TAlloc, typename TGrowth>
+bool operator>=(const vector<TType, TAlloc, TGrowth>& lhs, const vector<TType, TAlloc, TGrowth>& rhs)
 {
     return !(lhs < rhs);
 }
 
 }
+
+#include "vector_bool.h"
@@ -0,0 +1,741 @@
+#pragma once
+
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "iterator_traits.h"
+#include "reverse_iter.h"
+#include "type_traits.h"
+
+/// Included at the end of vector.h, after the primary template
+
+namespace ft
+{
+
+/// Proxy for one bit of a packed vector<bool>
+template <typename TWord>
+class BitReference
+{
+    TWord* m_Word;
+    TWord m_Mask;
+
+public:
+    BitReference(TWord* word, TWord mask) : m_Word(word), m_Mask(mask) {}
+
+    operator bool() const { return (*m_Word & m_Mask) != 0; }
+    bool operator~() const { return (*m_Word & m_Mask) == 0; }
+
+    BitReference& operator=(bool val)
+    {
+        if (val)
+        {
+            *m_Word |= m_Mask;
+        }
+        else
+        {
+            *m_Word &= ~m_Mask;
+        }
+        return *this;
+    }
+
+    BitReference& operator=(const BitReference& other)
+    {
+        return *this = static_cast<bool>(other);
+    }
+
+    void flip() { *m_Word ^= m_Mask; }
+};
+
+/// Random-access iterator over packed bits: a word pointer plus a bit offset inside it
+template <typename TWord, bool Const>
+class BitIterator
+{
+public:
+    typedef random_access_iterator_tag iterator_category;
+    typedef bool value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef typename conditional<Const, bool, BitReference<TWord> >::type reference;
+    typedef typename conditional<Const, const TWord*, TWord*>::type word_pointer;
+
+    static const size_type bits_per_word = sizeof(TWord) * CHAR_BIT;
+
+private:
+    word_pointer m_Word;
+    size_type m_Bit;
+
+public:
+    BitIterator() : m_Word(NULL), m_Bit(0) {}
+    BitIterator(word_pointer word, size_type bit) : m_Word(word), m_Bit(bit) {}
+
+    template <bool OtherConst>
+    BitIterator(const BitIterator<TWord, OtherConst>& other,
+                typename enable_if<Const && !OtherConst>::type* = NULL)
+        : m_Word(other.word())
+        , m_Bit(other.bit())
+    {}
+
+    word_pointer word() const { return m_Word; }
+    size_type bit() const { return m_Bit; }
+
+    friend bool operator==(const BitIterator& lhs, const BitIterator& rhs)
+    {
+        return lhs.m_Word == rhs.m_Word && lhs.m_Bit == rhs.m_Bit;
+    }
+
+    friend bool operator<(const BitIterator& lhs, const BitIterator& rhs)
+    {
+        return lhs.m_Word < rhs.m_Word || (lhs.m_Word == rhs.m_Word && lhs.m_Bit < rhs.m_Bit);
+    }
+
+    friend bool operator!=(const BitIterator& lhs, const BitIterator& rhs) { return !(lhs == rhs); }
+    friend bool operator>(const BitIterator& lhs, const BitIterator& rhs) { return rhs < lhs; }
+    friend bool operator<=(const BitIterator& lhs, const BitIterator& rhs) { return !(rhs < lhs); }
+    friend bool operator>=(const BitIterator& lhs, const BitIterator& rhs) { return !(lhs < rhs); }
+
+    reference operator*() const { return reference_to(m_Word, m_Bit); }
+    reference operator[](difference_type offset) const { return *(*this + offset); }
+
+    // prefix version
+    BitIterator& operator++()
+    {
+        if (++m_Bit == bits_per_word)
+        {
+            m_Bit = 0;
+            ++m_Word;
+        }
+        return *this;
+    }
+
+    BitIterator& operator--()
+    {
+        if (m_Bit-- == 0)
+        {
+            m_Bit = bits_per_word - 1;
+            --m_Word;
+        }
+        return *this;
+    }
+
+    // postfix version
+    BitIterator operator++(int)
+    {
+        BitIterator temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    BitIterator operator--(int)
+    {
+        BitIterator temp(*this);
+        --(*this);
+        return temp;
+    }
+
+    BitIterator& operator+=(difference_type offset)
+    {
+        difference_type position = static_cast<difference_type>(m_Bit) + offset;
+        difference_type words = position / static_cast<difference_type>(bits_per_word);
+        position %= static_cast<difference_type>(bits_per_word);
+        if (position < 0)
+        {
+            position += bits_per_word;
+            --words;
+        }
+        m_Word += words;
+        m_Bit = position;
+        return *this;
+    }
+
+    BitIterator& operator-=(difference_type offset)
+    {
+        return *this += -offset;
+    }
+
+    friend BitIterator operator+(BitIterator lhs, difference_type rhs) { return lhs += rhs; }
+    friend BitIterator operator+(difference_type lhs, BitIterator rhs) { return rhs += lhs; }
+    friend BitIterator operator-(BitIterator lhs, difference_type rhs) { return lhs -= rhs; }
+
+    friend difference_type operator-(const BitIterator& lhs, const BitIterator& rhs)
+    {
+        return (lhs.m_Word - rhs.m_Word) * static_cast<difference_type>(bits_per_word)
+               + static_cast<difference_type>(lhs.m_Bit) - static_cast<difference_type>(rhs.m_Bit);
+    }
+
+private:
+    static bool reference_to(const TWord* word, size_type bit) { return (*word >> bit) & 1; }
+    static BitReference<TWord> reference_to(TWord* word, size_type bit) { return BitReference<TWord>(word, TWord(1) << bit); }
+};
+
+/// vector<bool> packed into machine words, one bit per flag.
+/// Bits past size() are kept zero, so count, find and comparisons work on whole words.
+template <typename TAllocator, typename TGrowth>
+class vector<bool, TAllocator, TGrowth>
+{
+public:
+    typedef bool value_type;
+    typedef TAllocator allocator_type;
+    typedef TGrowth growth_policy;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef unsigned long long word_type;
+    typedef BitReference<word_type> reference;
+    typedef bool const_reference;
+    typedef BitIterator<word_type, false> iterator;
+    typedef BitIterator<word_type, true> const_iterator;
+    typedef ReverseIterator<iterator> reverse_iterator;
+    typedef ReverseIterator<const_iterator> const_reverse_iterator;
+
+    static const size_type bits_per_word = sizeof(word_type) * CHAR_BIT;
+    static const size_type npos = static_cast<size_type>(-1);
+
+private:
+    typedef typename allocator_type::template rebind<word_type>::other word_allocator;
+
+    word_allocator m_Allocator;
+    size_type m_Size;
+    size_type m_Capacity; /// in words
+    word_type* m_Words;
+
+public:
+    explicit vector(const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_Size(0)
+        , m_Capacity(0)
+        , m_Words(NULL)
+    {}
+
+    explicit vector(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type())
+        : m_Allocator(alloc)
+        , m_Size(0)
+        , m_Capacity(0)
+        , m_Words(NULL)
+    {
+        resize(count, value);
+    }
+
+    template <typename InputIterator>
+    vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+           typename enable_if<!is_integral<InputIterator>::value>::type* = NULL)
+        : m_Allocator(alloc)
+        , m_Size(0)
+        , m_Capacity(0)
+        , m_Words(NULL)
+    {
+        assign(first, last);
+    }
+
+    vector(const vector& other)
+        : m_Allocator(other.m_Allocator)
+        , m_Size(0)
+        , m_Capacity(0)
+        , m_Words(NULL)
+    {
+        *this = other;
+    }
+
+    vector& operator=(const vector& other)
+    {
+        if (&other != this)
+        {
+            size_type used = words_for(m_Size);
+            size_type other_used = words_for(other.m_Size);
+            if (other_used > m_Capacity)
+            {
+                replace_words(other_used);
+            }
+            else if (used > other_used)
+            {
+                std::memset(m_Words + other_used, 0, (used - other_used) * sizeof(word_type));
+            }
+            copy_words(m_Words, other.m_Words, other_used);
+            m_Size = other.m_Size;
+        }
+        return *this;
+    }
+
+    ~vector()
+    {
+        if (m_Words != NULL)
+        {
+            m_Allocator.deallocate(m_Words, m_Capacity);
+        }
+    }
+
+    allocator_type get_allocator() const
+    {
+        return allocator_type(m_Allocator);
+    }
+
+    // iterator methods
+    iterator begin() { return iterator(m_Words, 0); }
+    const_iterator begin() const { return const_iterator(m_Words, 0); }
+    iterator end() { return begin() + m_Size; }
+    const_iterator end() const { return begin() + m_Size; }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    // capacity methods
+    size_type size() const { return m_Size; }
+    size_type max_size() const { return std::numeric_limits<size_type>::max() - bits_per_word; }
+    size_type capacity() const { return m_Capacity * bits_per_word; }
+    bool empty() const { return m_Size == 0; }
+
+    void resize(size_type new_size, value_type val = value_type())
+    {
+        if (new_size > max_size())
+        {
+            throw std::length_error("resize of vector: new size is too much");
+        }
+        if (new_size > capacity())
+        {
+            reserve(recommend(new_size));
+        }
+        if (new_size > m_Size)
+        {
+            fill_bits(m_Size, new_size, val);
+        }
+        else
+        {
+            fill_bits(new_size, m_Size, false);
+        }
+        m_Size = new_size;
+    }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity > max_size())
+        {
+            throw std::length_error("reserve of vector: new capacity is too much");
+        }
+        if (words_for(new_capacity) > m_Capacity)
+        {
+            replace_words(words_for(new_capacity));
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        if (words_for(m_Size) < m_Capacity)
+        {
+            replace_words(words_for(m_Size));
+        }
+    }
+
+    // element access methods
+    reference operator[](size_type position) { return *(begin() + position); }
+    const_reference operator[](size_type position) const { return test(position); }
+
+    reference at(size_type position)
+    {
+        if (position >= m_Size)
+        {
+            throw std::out_of_range("out of range of vector");
+        }
+        return (*this)[position];
+    }
+
+    const_reference at(size_type position) const
+    {
+        if (position >= m_Size)
+        {
+            throw std::out_of_range("out of range of vector");
+        }
+        return test(position);
+    }
+
+    reference front() { return (*this)[0]; }
+    const_reference front() const { return test(0); }
+    reference back() { return (*this)[m_Size - 1]; }
+    const_reference back() const { return test(m_Size - 1); }
+
+    const word_type* words() const { return m_Words; }
+    size_type word_count() const { return words_for(m_Size); }
+
+    // modifiers methods
+    void assign(size_type count, const value_type& val)
+    {
+        clear();
+        resize(count, val);
+    }
+
+    template <typename InputIterator>
+    typename enable_if<!is_integral<InputIterator>::value>::type
+    assign(InputIterator first, InputIterator last)
+    {
+        clear();
+        for (; first != last; ++first)
+        {
+            push_back(*first);
+        }
+    }
+
+    void push_back(const value_type& val)
+    {
+        if (m_Size == capacity())
+        {
+            reserve(recommend(m_Size + 1));
+        }
+        if (val)
+        {
+            m_Words[m_Size / bits_per_word] |= word_type(1) << (m_Size % bits_per_word);
+        }
+        ++m_Size;
+    }
+
+    void pop_back()
+    {
+        --m_Size;
+        m_Words[m_Size / bits_per_word] &= ~(word_type(1) << (m_Size % bits_per_word));
+    }
+
+    iterator insert(iterator position, const value_type& val)
+    {
+        size_type inserting_idx = position - begin();
+        insert(position, 1, val);
+        return begin() + inserting_idx;
+    }
+
+    void insert(iterator position, size_type inserted_cnt, const value_type& val)
+    {
+        size_type inserting_idx = make_gap(position - begin(), inserted_cnt);
+        fill_bits(inserting_idx, inserting_idx + inserted_cnt, val);
+    }
+
+    template <typename InputIterator>
+    typename enable_if<!is_integral<InputIterator>::value>::type
+    insert(iterator position, InputIterator first, InputIterator last)
+    {
+        vector inserted(first, last); /// also covers single-pass iterators and ranges of ourselves
+        size_type inserting_idx = make_gap(position - begin(), inserted.m_Size);
+        for (size_type i = 0; i < inserted.m_Size; ++i)
+        {
+            set(inserting_idx + i, inserted.test(i));
+        }
+    }
+
+    iterator erase(iterator position)
+    {
+        return erase(position, position + 1);
+    }
+
+    iterator erase(iterator first, iterator last)
+    {
+        size_type start_idx = first - begin();
+        size_type end_idx = last - begin();
+        move_bits_down(start_idx, end_idx, m_Size - end_idx);
+        size_type new_size = m_Size - (end_idx - start_idx);
+        fill_bits(new_size, m_Size, false);
+        m_Size = new_size;
+        return begin() + start_idx;
+    }
+
+    void swap(vector& x)
+    {
+        word_allocator tmp_alloc = m_Allocator;
+        size_type tmp_size = m_Size;
+        size_type tmp_capacity = m_Capacity;
+        word_type* tmp_words = m_Words;
+
+        m_Allocator = x.m_Allocator;
+        m_Size = x.m_Size;
+        m_Capacity = x.m_Capacity;
+        m_Words = x.m_Words;
+
+        x.m_Allocator = tmp_alloc;
+        x.m_Size = tmp_size;
+        x.m_Capacity = tmp_capacity;
+        x.m_Words = tmp_words;
+    }
+
+    void clear()
+    {
+        clear_words(0, words_for(m_Size));
+        m_Size = 0;
+    }
+
+    // bitmap methods
+    void flip()
+    {
+        size_type used = words_for(m_Size);
+        for (size_type i = 0; i < used; ++i)
+        {
+            m_Words[i] = ~m_Words[i];
+        }
+        clear_tail();
+    }
+
+    size_type count() const /// number of set bits
+    {
+        size_type total = 0;
+        size_type used = words_for(m_Size);
+        for (size_type i = 0; i < used; ++i)
+        {
+            total += __builtin_popcountll(m_Words[i]);
+        }
+        return total;
+    }
+
+    size_type find_first() const { return find_from(0); }
+
+    size_type find_next(size_type position) const /// first set bit after position, or npos
+    {
+        return position + 1 >= m_Size ? npos : find_from(position + 1);
+    }
+
+    /// Bulk operations need equal sizes; the word loops are left to the compiler to vectorize
+    vector& operator&=(const vector& other)
+    {
+        check_same_size(other);
+        if (&other == this) /// x & x is x, and the words must not alias below
+        {
+            return *this;
+        }
+        word_type* __restrict words = m_Words;
+        const word_type* __restrict other_words = other.m_Words;
+        size_type used = words_for(m_Size);
+        for (size_type i = 0; i < used; ++i)
+        {
+            words[i] &= other_words[i];
+        }
+        return *this;
+    }
+
+    vector& operator|=(const vector& other)
+    {
+        check_same_size(other);
+        if (&other == this) /// x | x is x, and the words must not alias below
+        {
+            return *this;
+        }
+        word_type* __restrict words = m_Words;
+        const word_type* __restrict other_words = other.m_Words;
+        size_type used = words_for(m_Size);
+        for (size_type i = 0; i < used; ++i)
+        {
+            words[i] |= other_words[i];
+        }
+        return *this;
+    }
+
+    vector& operator^=(const vector& other)
+    {
+        check_same_size(other);
+        if (&other == this)
+        {
+            clear_words(0, words_for(m_Size));
+            return *this;
+        }
+        word_type* __restrict words = m_Words;
+        const word_type* __restrict other_words = other.m_Words;
+        size_type used = words_for(m_Size);
+        for (size_type i = 0; i < used; ++i)
+        {
+            words[i] ^= other_words[i];
+        }
+        return *this;
+    }
+
+private:
+    static size_type words_for(size_type bits)
+    {
+        return (bits + bits_per_word - 1) / bits_per_word;
+    }
+
+    size_type recommend(size_type new_size) const
+    {
+        size_type words = growth_policy::next_capacity(m_Capacity, words_for(new_size), sizeof(word_type));
+        size_type max_words = words_for(max_size());
+        return (words < max_words ? words : max_words) * bits_per_word;
+    }
+
+    bool test(size_type position) const
+    {
+        return (m_Words[position / bits_per_word] >> (position % bits_per_word)) & 1;
+    }
+
+    void set(size_type position, bool val)
+    {
+        word_type mask = word_type(1) << (position % bits_per_word);
+        word_type& word = m_Words[position / bits_per_word];
+        word = val ? word | mask : word & ~mask;
+    }
+
+    /// Reads the bits_per_word bits starting at position, joining two words when it is unaligned
+    word_type read_bits(size_type position) const
+    {
+        size_type idx = position / bits_per_word;
+        size_type shift = position % bits_per_word;
+        word_type bits = m_Words[idx] >> shift;
+        if (shift != 0 && idx + 1 < m_Capacity)
+        {
+            bits |= m_Words[idx + 1] << (bits_per_word - shift);
+        }
+        return bits;
+    }
+
+    /// Writes the low count bits of bits at position, 0 < count <= bits_per_word
+    void write_bits(size_type position, word_type bits, size_type count)
+    {
+        size_type idx = position / bits_per_word;
+        size_type shift = position % bits_per_word;
+        word_type mask = count == bits_per_word ? ~word_type(0) : (word_type(1) << count) - 1;
+        bits &= mask;
+        m_Words[idx] = (m_Words[idx] & ~(mask << shift)) | (bits << shift);
+        if (shift + count > bits_per_word)
+        {
+            m_Words[idx + 1] = (m_Words[idx + 1] & ~(mask >> (bits_per_word - shift))) | (bits >> (bits_per_word - shift));
+        }
+    }
+
+    /// Moves count bits from source down to destination < source a word at a time, lowest first
+    void move_bits_down(size_type destination, size_type source, size_type count)
+    {
+        for (size_type done = 0; done < count; done += bits_per_word)
+        {
+            size_type chunk = count - done < bits_per_word ? count - done : bits_per_word;
+            write_bits(destination + done, read_bits(source + done), chunk);
+        }
+    }
+
+    /// Moves count bits from source up to destination > source a word at a time, highest first
+    void move_bits_up(size_type destination, size_type source, size_type count)
+    {
+        while (count != 0)
+        {
+            size_type chunk = count < bits_per_word ? count : bits_per_word;
+            count -= chunk;
+            write_bits(destination + count, read_bits(source + count), chunk);
+        }
+    }
+
+    /// Sets bits [first, last) to val: partial words bit by bit, whole words at once
+    void fill_bits(size_type first, size_type last, bool val)
+    {
+        while (first < last && first % bits_per_word != 0)
+        {
+            set(first++, val);
+        }
+        size_type whole_end = first + (last - first) / bits_per_word * bits_per_word;
+        if (first < whole_end)
+        {
+            std::memset(m_Words + first / bits_per_word, val ? 0xff : 0, (whole_end - first) / bits_per_word * sizeof(word_type));
+            first = whole_end;
+        }
+        while (first < last)
+        {
+            set(first++, val);
+        }
+    }
+
+    void clear_words(size_type first, size_type last)
+    {
+        if (first < last)
+        {
+            std::memset(m_Words + first, 0, (last - first) * sizeof(word_type));
+        }
+    }
+
+    void clear_tail()
+    {
+        if (m_Size % bits_per_word != 0)
+        {
+            m_Words[m_Size / bits_per_word] &= (word_type(1) << (m_Size % bits_per_word)) - 1;
+        }
+    }
+
+    size_type find_from(size_type position) const
+    {
+        if (position >= m_Size)
+        {
+            return npos;
+        }
+        size_type idx = position / bits_per_word;
+        size_type used = words_for(m_Size);
+        word_type word = m_Words[idx] & (~word_type(0) << (position % bits_per_word));
+        while (word == 0)
+        {
+            if (++idx == used)
+            {
+                return npos;
+            }
+            word = m_Words[idx];
+        }
+        return idx * bits_per_word + __builtin_ctzll(word);
+    }
+
+    /// Shifts bits from idx on count places up, the gap is left for the caller to fill
+    size_type make_gap(size_type idx, size_type count)
+    {
+        if (count == 0)
+        {
+            return idx;
+        }
+        if (m_Size + count > capacity())
+        {
+            reserve(recommend(m_Size + count));
+        }
+        move_bits_up(idx + count, idx, m_Size - idx);
+        m_Size += count;
+        return idx;
+    }
+
+    void replace_words(size_type new_capacity)
+    {
+        word_type* new_words = new_capacity == 0 ? NULL : m_Allocator.allocate(new_capacity);
+        size_type used = words_for(m_Size);
+        copy_words(new_words, m_Words, used);
+        if (new_capacity > used)
+        {
+            std::memset(new_words + used, 0, (new_capacity - used) * sizeof(word_type));
+        }
+        if (m_Words != NULL)
+        {
+            m_Allocator.deallocate(m_Words, m_Capacity);
+        }
+        m_Words = new_words;
+        m_Capacity = new_capacity;
+    }
+
+    static void copy_words(word_type* destination, const word_type* source, size_type count)
+    {
+        if (count != 0)
+        {
+            std::memcpy(destination, source, count * sizeof(word_type));
+        }
+    }
+
+    void check_same_size(const vector& other) const
+    {
+        if (other.m_Size != m_Size)
+        {
+            throw std::invalid_argument("bitwise operation of vector<bool>: sizes differ");
+        }
+    }
+};
+
+template <typename TAllocator, typename TGrowth>
+const std::size_t vector<bool, TAllocator, TGrowth>::bits_per_word;
+
+template <typename TAllocator, typename TGrowth>
+const std::size_t vector<bool, TAllocator, TGrowth>::npos;
+
+template <typename TAlloc, typename TGrowth>
+bool operator==(const vector<bool, TAlloc, TGrowth>& lhs, const vector<bool, TAlloc, TGrowth>& rhs)
+{
+    return lhs.size() == rhs.size()
+           && (lhs.empty() || std::memcmp(lhs.words(), rhs.words(), lhs.word_count() * sizeof(*lhs.words())) == 0);
+}
+
+}
@@ -1,7 +1,7 @@
 #include <iostream>
 #include <string>
-#include <deque>
 #if 0 //CREATE A REAL STL EXAMPLE
+    #include <deque>
     #include <map>
     #include <stack>
     #include <vector>
@@ -12,6 +12,7 @@
 //	#include <stack.hpp>
 	#include "vector.h"
     #include "stack.h"
+    #include "deque.h"
     #include "map.h"
     #include <vector>
 #endif
@@ -63,7 +64,7 @@ int main(int argc, char** argv) {
     ft::vector<int> vector_int;
     ft::stack<int> stack_int;
     ft::vector<Buffer> vector_buffer;
-    ft::stack<Buffer, std::deque<Buffer> > stack_deq_buffer;
+    ft::stack<Buffer, ft::deque<Buffer> > stack_deq_buffer;
     ft::map<int, int> map_int;
 
     for (int i = 0; i < COUNT; i++)
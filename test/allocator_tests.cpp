@@ -0,0 +1,85 @@
+#include "map.h"
+#include "vector.h"
+#include <gtest/gtest.h>
+
+TEST(AllocatorTests, HasReallocate)
+{
+    ASSERT_TRUE(ft::has_reallocate<ft::malloc_allocator<int> >::value);
+    ASSERT_TRUE(ft::has_reallocate<ft::page_allocator<int> >::value);
+    ASSERT_FALSE(ft::has_reallocate<std::allocator<int> >::value);
+}
+
+template <typename TAlloc>
+void check_growth()
+{
+    ft::vector<int, TAlloc> v;
+    for (int i = 0; i < 1'000'000; ++i)
+    {
+        v.push_back(i);
+    }
+    v.reserve(3'000'000);
+    ASSERT_EQ(v.capacity(), 3'000'000);
+    ASSERT_EQ(v.size(), 1'000'000);
+    for (int i = 0; i < 1'000'000; ++i)
+    {
+        ASSERT_EQ(v[i], i);
+    }
+}
+
+TEST(AllocatorTests, MallocAllocatorVector)
+{
+    check_growth<ft::malloc_allocator<int> >();
+}
+
+TEST(AllocatorTests, PageAllocatorVector)
+{
+    check_growth<ft::page_allocator<int> >();
+}
+
+TEST(AllocatorTests, PageAllocatorNonTrivial)
+{
+    ft::vector<std::string, ft::page_allocator<std::string> > v;
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(std::string(40, 'a' + i % 26));
+    }
+    ASSERT_EQ(v[999], std::string(40, 'a' + 999 % 26));
+}
+
+TEST(AllocatorTests, AlignedAllocatorVector)
+{
+    ft::vector<double, ft::aligned_allocator<double, 64> > v;
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(i);
+        ASSERT_EQ(reinterpret_cast<std::size_t>(&v[0]) % 64, 0);
+    }
+    ASSERT_EQ(v[999], 999);
+    ASSERT_EQ((ft::aligned_allocator<long double, 4>::alignment), alignof(long double));
+}
+
+TEST(AllocatorTests, HugePageAllocatorVector)
+{
+    check_growth<ft::huge_page_allocator<int> >();
+
+    ft::vector<double, ft::huge_page_allocator<double> > big(size_t(1 << 20), 1.5);
+    ASSERT_EQ(reinterpret_cast<std::size_t>(&big[0]) % ft::huge_page_allocator<double>::huge_page_size, 0);
+    ASSERT_EQ(big.back(), 1.5);
+
+    ft::vector<double, ft::huge_page_allocator<double> > small(size_t(10), 2.5);
+    ASSERT_EQ(reinterpret_cast<std::size_t>(&small[0]) % 64, 0);
+}
+
+TEST(AllocatorTests, AlignedAllocatorMap)
+{
+    typedef ft::pair<const int, int> value_type;
+    ft::map<int, int, std::less<int>, ft::aligned_allocator<value_type> > aligned;
+    ft::map<int, int, std::less<int>, ft::huge_page_allocator<value_type> > huge;
+    for (int i = 0; i < 1000; ++i)
+    {
+        aligned[i] = i * 2;
+        huge[i] = i * 3;
+    }
+    ASSERT_EQ(aligned[500], 1000);
+    ASSERT_EQ(huge[500], 1500);
+}
@@ -0,0 +1,53 @@
+#include "back_insert_buffer.h"
+#include "vector.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+
+TEST(BackInsertBufferTests, BatchesIntoVector)
+{
+    ft::vector<int> v;
+    {
+        ft::back_insert_buffer<ft::vector<int>, 16 * sizeof(int)> buffer(v);
+        for (int i = 0; i < 40; ++i)
+        {
+            buffer.push_back(i);
+        }
+        ASSERT_EQ(v.size(), 32);
+        buffer.flush();
+        ASSERT_EQ(v.size(), 40);
+
+        int raw[] = {100, 101, 102};
+        std::copy(raw, raw + 3, buffer.inserter());
+        ASSERT_EQ(v.size(), 40);
+        buffer.flush();
+    }
+    ASSERT_EQ(v.size(), 43);
+    ASSERT_EQ(v[39], 39);
+    ASSERT_EQ(v.back(), 102);
+}
+
+TEST(BackInsertBufferTests, NonTrivialValues)
+{
+    ft::vector<std::string> v;
+    {
+        ft::back_insert_buffer<ft::vector<std::string>, 4 * sizeof(std::string)> buffer(v);
+        ASSERT_EQ(buffer.batch_size, 4);
+        std::fill_n(buffer.inserter(), 10, std::string(50, 'x'));
+        ASSERT_EQ(v.size(), 8);
+        buffer.flush();
+    }
+    ASSERT_EQ(v.size(), 10);
+    ASSERT_EQ(v[9], std::string(50, 'x'));
+}
+
+TEST(BackInsertBufferTests, BatchSizedInBytes)
+{
+    struct Large
+    {
+        char bytes[8192];
+    };
+    ASSERT_EQ((ft::back_insert_buffer<ft::vector<int> >::batch_size), 4096 / sizeof(int));
+    ASSERT_EQ((ft::back_insert_buffer<ft::vector<Large> >::batch_size), 1);
+}
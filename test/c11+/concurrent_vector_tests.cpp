@@ -0,0 +1,169 @@
+#include "concurrent_vector.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+struct Entry
+{
+    static int live;
+    static int copies_left;
+
+    int value;
+
+    explicit Entry(int v) : value(v) { ++live; }
+    Entry(ft::concurrent_vector<Entry>& owner, int v) : value(v) /// reserves past itself, then fails
+    {
+        owner.emplace_back(v);
+        throw std::runtime_error("construction failed");
+    }
+    Entry(const Entry& other) : value(other.value)
+    {
+        if (copies_left-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+        ++live;
+    }
+    ~Entry() { --live; }
+};
+
+int Entry::live = 0;
+int Entry::copies_left = -1;
+
+}
+
+TEST(ConcurrentVectorTests, SingleThread)
+{
+    ft::concurrent_vector<std::string> v;
+    v.push_back("first");
+    std::string* first = &v[0];
+    for (int i = 1; i < 1000; ++i)
+    {
+        v.emplace_back(3, 'a' + i % 26);
+    }
+    ASSERT_EQ(first, &v[0]);
+    ASSERT_EQ(v.size(), 1000);
+    ASSERT_EQ(v.front(), "first");
+    ASSERT_EQ(v.back(), std::string(3, 'a' + 999 % 26));
+    ASSERT_GE(v.capacity(), 1000);
+    ASSERT_THROW(v.at(1000), std::out_of_range);
+
+    auto range = v.grow_by(5, "x");
+    ASSERT_EQ(range - v.begin(), 1000);
+    ASSERT_EQ(v.size(), 1005);
+    ASSERT_EQ(*range, "x");
+    ASSERT_EQ(std::count(v.begin(), v.end(), "x"), 5);
+
+    ft::concurrent_vector<std::string> copy(v);
+    ASSERT_EQ(copy.size(), v.size());
+    ASSERT_TRUE(std::equal(v.begin(), v.end(), copy.begin()));
+    copy.clear();
+    ASSERT_TRUE(copy.empty());
+    copy.grow_by(3);
+    ASSERT_EQ(copy[2], "");
+    v.swap(copy);
+    ASSERT_EQ(v.size(), 3);
+    ASSERT_EQ(copy.size(), 1005);
+}
+
+TEST(ConcurrentVectorTests, ConcurrentAppends)
+{
+    const int threads = 8;
+    const int per_thread = 20000;
+    ft::concurrent_vector<long> v;
+    std::atomic<bool> done(false);
+    std::atomic<long> reader_errors(0);
+
+    std::thread reader([&]() {
+        while (!done.load())
+        {
+            long sum = 0;
+            for (auto it = v.begin(); it != v.end(); ++it)
+            {
+                if (*it < 0)
+                {
+                    ++reader_errors;
+                }
+                sum += *it;
+            }
+            (void)sum;
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < threads; ++t)
+    {
+        writers.emplace_back([&v, t]() {
+            for (int i = 0; i < per_thread; ++i)
+            {
+                if (i % 100 == 0)
+                {
+                    v.grow_by(10, t * per_thread + i);
+                }
+                else
+                {
+                    v.push_back(t * per_thread + i);
+                }
+            }
+        });
+    }
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+    done = true;
+    reader.join();
+
+    const size_t expected = threads * per_thread + threads * (per_thread / 100) * 9;
+    ASSERT_EQ(v.size(), expected);
+    ASSERT_EQ(reader_errors.load(), 0);
+    std::vector<long> values(v.begin(), v.end());
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    ASSERT_EQ(values.size(), static_cast<size_t>(threads * per_thread));
+}
+
+TEST(ConcurrentVectorTests, ThrowingConstructorsDoNotStall)
+{
+    {
+        ft::concurrent_vector<Entry> v;
+        v.emplace_back(0);
+
+        Entry::copies_left = 2; /// the third copy of the batch fails
+        ASSERT_THROW(v.grow_by(5, Entry(1)), std::runtime_error);
+        Entry::copies_left = -1;
+        ASSERT_EQ(v.size(), 1); /// nothing reserved after the batch, so its indices are handed back
+        ASSERT_EQ(Entry::live, 1);
+
+        ASSERT_THROW(v.emplace_back(v, 2), std::runtime_error);
+        ASSERT_EQ(v.size(), 3); /// index 1 is dead, the element it appended in between is published
+        ASSERT_THROW(v.at(1), std::out_of_range);
+        ASSERT_EQ(v.at(2).value, 2);
+
+        v.emplace_back(3);
+        ASSERT_EQ(v.size(), 4);
+        std::vector<int> values;
+        for (auto it = v.begin(); it != v.end(); ++it)
+        {
+            values.push_back(it->value);
+        }
+        ASSERT_EQ(values, std::vector<int>({0, 2, 3}));
+        ASSERT_EQ(std::distance(v.begin(), v.end()), 3);
+        ASSERT_EQ((--(--v.end()))->value, 2);
+        ASSERT_TRUE(v.begin() + 2 == v.begin() + 1); /// only a dead slot between them
+
+        ft::concurrent_vector<Entry> copy(v);
+        ASSERT_EQ(copy.size(), 3);
+        ASSERT_EQ(copy[1].value, 2);
+        ASSERT_EQ(Entry::live, 6);
+    }
+    ASSERT_EQ(Entry::live, 0);
+}
@@ -0,0 +1,122 @@
+#include "lockfree_stack.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(LockfreeStackTests, SingleThread)
+{
+    ft::lockfree_stack<std::string> stack;
+    ASSERT_TRUE(stack.empty());
+    std::string out;
+    ASSERT_FALSE(stack.try_pop(out));
+
+    for (int i = 0; i < 100; ++i)
+    {
+        stack.push(std::to_string(i));
+    }
+    stack.emplace(3, 'x');
+    ASSERT_TRUE(stack.try_pop(out));
+    ASSERT_EQ(out, "xxx");
+    ASSERT_TRUE(stack.try_pop(out));
+    ASSERT_EQ(out, "99");
+
+    std::vector<std::string> bulk;
+    ASSERT_EQ(stack.try_pop_bulk(std::back_inserter(bulk), 10), 10);
+    ASSERT_EQ(bulk.front(), "98");
+    ASSERT_EQ(bulk.back(), "89");
+    ASSERT_EQ(stack.try_pop_bulk(std::back_inserter(bulk), 1000), 89);
+    ASSERT_EQ(bulk.back(), "0");
+    ASSERT_TRUE(stack.empty());
+
+    stack.push("reused");
+    ASSERT_TRUE(stack.try_pop(out));
+    ASSERT_EQ(out, "reused");
+    stack.push("left for the destructor");
+}
+
+TEST(LockfreeStackTests, Bounded)
+{
+    ft::bounded_stack<std::string> stack(3);
+    ASSERT_EQ(stack.capacity(), 3);
+    ASSERT_TRUE(stack.try_push("a"));
+    ASSERT_TRUE(stack.try_push("b"));
+    ASSERT_TRUE(stack.try_emplace(1, 'c'));
+    ASSERT_FALSE(stack.try_push("d"));
+
+    std::string out;
+    ASSERT_TRUE(stack.try_pop(out));
+    ASSERT_EQ(out, "c");
+    ASSERT_TRUE(stack.try_push("e"));
+
+    std::string bulk[3];
+    ASSERT_EQ(stack.try_pop_bulk(bulk, 3), 3);
+    ASSERT_EQ(bulk[0], "e");
+    ASSERT_EQ(bulk[2], "a");
+    ASSERT_TRUE(stack.empty());
+
+    ft::bounded_stack<int> none(0);
+    ASSERT_FALSE(none.try_push(1));
+}
+
+template <typename TPush, typename TPop>
+void exchange_between_threads(TPush push, TPop pop_bulk)
+{
+    const int producers = 4;
+    const int consumers = 4;
+    const int per_producer = 20000;
+    std::vector<std::atomic<int>> seen(producers * per_producer);
+    std::atomic<int> popped(0);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < per_producer; ++i)
+            {
+                push(p * per_producer + i);
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back([&, c]() {
+            int values[8];
+            while (popped.load() < producers * per_producer)
+            {
+                std::size_t count = pop_bulk(values, c % 2 == 0 ? 1 : 8);
+                if (count == 0)
+                {
+                    std::this_thread::yield();
+                }
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    seen[values[i]].fetch_add(1);
+                }
+                popped.fetch_add(static_cast<int>(count));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(popped.load(), producers * per_producer);
+    ASSERT_TRUE(std::all_of(seen.begin(), seen.end(), [](const std::atomic<int>& hits) { return hits.load() == 1; }));
+}
+
+TEST(LockfreeStackTests, ConcurrentPushPop)
+{
+    ft::lockfree_stack<int> stack;
+    exchange_between_threads([&](int value) { stack.push(value); },
+                             [&](int* out, std::size_t max) { return stack.try_pop_bulk(out, max); });
+    ASSERT_TRUE(stack.empty());
+
+    ft::bounded_stack<int> bounded(64);
+    exchange_between_threads([&](int value) { while (!bounded.try_push(value)) { std::this_thread::yield(); } },
+                             [&](int* out, std::size_t max) { return bounded.try_pop_bulk(out, max); });
+    ASSERT_TRUE(bounded.empty());
+}
@@ -0,0 +1,120 @@
+#include "soa_vector.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <utility>
+
+TEST(SoaVectorTests, PushBackAndColumns)
+{
+    ft::soa_vector<std::uint64_t, double> v;
+    for (std::uint64_t i = 0; i < 1000; ++i)
+    {
+        v.push_back(i, i * 0.5);
+    }
+    ASSERT_EQ(v.size(), 1000);
+    ASSERT_GE(v.capacity(), 1000);
+
+    auto keys = v.column<0>();
+    auto values = v.column<1>();
+    ASSERT_EQ(keys.size(), 1000);
+    ASSERT_EQ(keys.data(), v.data<0>());
+    ASSERT_EQ(keys[10], 10);
+    ASSERT_EQ(values[10], 5.0);
+    ASSERT_EQ(std::accumulate(keys.begin(), keys.end(), std::uint64_t(0)), 999 * 1000 / 2);
+
+    ASSERT_EQ(v[3].first, 3);
+    ASSERT_EQ(v[3].second, 1.5);
+    ASSERT_EQ(v.back().get<0>(), 999);
+    v[3].second = 7.0;
+    ASSERT_EQ(values[3], 7.0);
+
+    std::pair<std::uint64_t, double> row = v.front();
+    ASSERT_EQ(row.first, 0);
+    std::tuple<std::uint64_t, double> tuple_row = v[3];
+    ASSERT_EQ(std::get<1>(tuple_row), 7.0);
+    v[4] = std::make_pair(std::uint64_t(40), 4.5);
+    ASSERT_EQ(v[4].first, 40);
+    v[5] = v[4];
+    ASSERT_EQ(v[5].second, 4.5);
+    ASSERT_THROW(v.at(1000), std::out_of_range);
+}
+
+TEST(SoaVectorTests, Erase)
+{
+    ft::soa_vector<int, std::string> v;
+    for (int i = 0; i < 10; ++i)
+    {
+        v.push_back(std::make_tuple(i, std::to_string(i)));
+    }
+    auto it = v.erase(v.begin() + 2, v.begin() + 5);
+    ASSERT_EQ(it - v.begin(), 2);
+    ASSERT_EQ(v.size(), 7);
+    ASSERT_EQ(v[2].first, 5);
+    ASSERT_EQ(v[2].second, "5");
+    v.erase(v.begin());
+    ASSERT_EQ(v.front().second, "1");
+    v.pop_back();
+    ASSERT_EQ(v.back().first, 8);
+    ASSERT_EQ(v.column<1>().size(), 5);
+    ASSERT_EQ(v.erase(v.end(), v.end()), v.end());
+}
+
+TEST(SoaVectorTests, IteratorAndCopy)
+{
+    ft::soa_vector<int, char, std::string> v;
+    v.resize(5);
+    ASSERT_EQ(v[4].get<2>(), "");
+    int n = 0;
+    for (auto row : v)
+    {
+        row.get<0>() = n;
+        row.get<1>() = char('a' + n);
+        row.get<2>() = std::string(n, 'x');
+        ++n;
+    }
+    ASSERT_EQ(v.end() - v.begin(), 5);
+    ASSERT_EQ((*(v.rbegin())).get<1>(), 'e');
+    auto found = std::find_if(v.begin(), v.end(), [](ft::soa_vector<int, char, std::string>::reference row) { return row.get<0>() == 3; });
+    ASSERT_EQ(found - v.begin(), 3);
+
+    ft::soa_vector<int, char, std::string> copy(v);
+    ASSERT_EQ(copy.size(), 5);
+    ASSERT_EQ(copy[3].get<2>(), "xxx");
+    ASSERT_NE(copy.data<2>(), v.data<2>());
+
+    const ft::soa_vector<int, char, std::string>& cref = copy;
+    ft::soa_vector<int, char, std::string>::const_iterator cit = v.begin();
+    ASSERT_EQ((*cit).get<0>(), 0);
+    ASSERT_EQ(cref.column<2>()[4], "xxxx");
+
+    ft::soa_vector<int, char, std::string> moved(std::move(copy));
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(moved.size(), 5);
+    v.clear();
+    ASSERT_TRUE(v.empty());
+    swap(v, moved);
+    ASSERT_EQ(v.size(), 5);
+    ASSERT_TRUE(moved.empty());
+    v.resize(2);
+    ASSERT_EQ(v.back().get<2>(), "x");
+}
+
+TEST(SoaVectorTests, PushBackOwnElementWhileGrowing)
+{
+    ft::soa_vector<std::string, int> v;
+    v.push_back(std::string(40, 'a'), 1);
+    for (int i = 0; i < 10; ++i)
+    {
+        v.push_back(v[0].first, v[0].second); /// reallocates whenever size hits capacity
+    }
+    ASSERT_EQ(v.size(), 11);
+    for (const auto& text : v.column<0>())
+    {
+        ASSERT_EQ(text, std::string(40, 'a'));
+    }
+    ASSERT_EQ(std::accumulate(v.column<1>().begin(), v.column<1>().end(), 0), 11);
+}
@@ -0,0 +1,286 @@
+#include "vector_c11+.hpp"
+#include "concurrent_vector.hpp"
+#include "soa_vector.hpp"
+#include "lockfree_stack.hpp"
+#include "work_stealing_deque.hpp"
+
+#include <vector>
+#include <string>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stack>
+#include <thread>
+
+template <typename TVector>
+void fill_strings()
+{
+    TVector v;
+    for (auto i = 0; i < 1'000'000; ++i)
+    {
+        v.push_back(std::string(1000, i));
+    }
+    for (auto i = 0; i < 10; ++i)
+    {
+        v.insert(v.begin(), std::string(1000, i));
+        v.erase(v.begin() + 1);
+    }
+}
+
+void test_vector_string_ft() { fill_strings<ft::vector<std::string>>(); std::cout << __FUNCTION__ << ": "; }
+void test_vector_string_std() { fill_strings<std::vector<std::string>>(); std::cout << __FUNCTION__ << ": "; }
+
+/// 8M appends split across threads: one shared vector behind a mutex vs concurrent_vector
+template <typename TAppend>
+void append_from_threads(size_t threads, TAppend append)
+{
+    const size_t total = 8'000'000;
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&append, t, threads, total]() {
+            for (size_t i = t; i < total; i += threads)
+            {
+                append(i);
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void append_scaling(size_t threads)
+{
+    ft::vector<size_t> locked;
+    std::mutex lock;
+    auto start = std::chrono::steady_clock::now();
+    append_from_threads(threads, [&](size_t i) { std::lock_guard<std::mutex> guard(lock); locked.push_back(i); });
+    auto middle = std::chrono::steady_clock::now();
+    ft::concurrent_vector<size_t> concurrent;
+    append_from_threads(threads, [&](size_t i) { concurrent.push_back(i); });
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "append with " << threads << " threads: mutex+vector "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(middle - start).count() << " ms, concurrent_vector "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - middle).count() << " ms, total ";
+}
+
+void test_concurrent_append_1() { append_scaling(1); }
+void test_concurrent_append_2() { append_scaling(2); }
+void test_concurrent_append_4() { append_scaling(4); }
+void test_concurrent_append_8() { append_scaling(8); }
+
+/// Sums the keys of 4M (key, value) rows 20 times: array of pairs vs the key column of soa_vector
+const size_t scan_rows = 4'000'000;
+const size_t scan_passes = 20;
+volatile std::uint64_t scan_sink;
+
+void test_key_scan_pairs()
+{
+    ft::vector<std::pair<std::uint64_t, double>> rows;
+    for (size_t i = 0; i < scan_rows; ++i)
+    {
+        rows.push_back(std::make_pair(std::uint64_t(i), i * 0.5));
+    }
+    std::uint64_t sum = 0;
+    for (size_t pass = 0; pass < scan_passes; ++pass)
+    {
+        for (const auto& row : rows)
+        {
+            sum += row.first;
+        }
+    }
+    scan_sink = sum;
+    std::cout << __FUNCTION__ << ": ";
+}
+
+void test_key_scan_soa()
+{
+    ft::soa_vector<std::uint64_t, double> rows;
+    for (size_t i = 0; i < scan_rows; ++i)
+    {
+        rows.push_back(std::uint64_t(i), i * 0.5);
+    }
+    std::uint64_t sum = 0;
+    for (size_t pass = 0; pass < scan_passes; ++pass)
+    {
+        for (std::uint64_t key : rows.column<0>())
+        {
+            sum += key;
+        }
+    }
+    scan_sink = sum;
+    std::cout << __FUNCTION__ << ": ";
+}
+
+/// Each thread pushes and pops in pairs, 4M operations in total. The c98 ft::stack can't share
+/// a binary with the c11+ ft::vector, so the locked baseline is std::stack over ft::vector
+template <typename TPushPop>
+long long push_pop_from_threads(size_t threads, TPushPop push_pop)
+{
+    const size_t total_pairs = 2'000'000;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&push_pop, threads, total_pairs]() {
+            for (size_t i = 0; i < total_pairs / threads; ++i)
+            {
+                push_pop(i);
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+void stack_contention(size_t threads)
+{
+    std::stack<size_t, ft::vector<size_t>> locked;
+    std::mutex lock;
+    long long locked_ms = push_pop_from_threads(threads, [&](size_t i) {
+        std::lock_guard<std::mutex> guard(lock);
+        locked.push(i);
+        locked.pop();
+    });
+    ft::lockfree_stack<size_t> lockfree;
+    long long lockfree_ms = push_pop_from_threads(threads, [&](size_t i) {
+        size_t out;
+        lockfree.push(i);
+        lockfree.try_pop(out);
+    });
+    ft::bounded_stack<size_t> bounded(1024);
+    long long bounded_ms = push_pop_from_threads(threads, [&](size_t i) {
+        size_t out;
+        bounded.try_push(i);
+        bounded.try_pop(out);
+    });
+    std::cout << "stack push/pop with " << threads << " threads: mutex+stack " << locked_ms << " ms, lockfree_stack "
+              << lockfree_ms << " ms, bounded_stack " << bounded_ms << " ms, total ";
+}
+
+void test_stack_contention_1() { stack_contention(1); }
+void test_stack_contention_2() { stack_contention(2); }
+void test_stack_contention_4() { stack_contention(4); }
+void test_stack_contention_8() { stack_contention(8); }
+
+/// Fork/join sum of 64M values: each worker splits its range in halves, pushes the right
+/// half on its own deque and keeps going left; idle workers steal from random victims
+struct sum_task
+{
+    std::uint32_t begin;
+    std::uint32_t end;
+};
+
+void parallel_sum(size_t threads)
+{
+    const std::uint32_t count = 64u << 20;
+    const std::uint32_t grain = 1u << 14;
+    ft::vector<std::uint32_t> values(count, 3);
+
+    std::vector<std::unique_ptr<ft::work_stealing_deque<sum_task>>> deques;
+    for (size_t t = 0; t < threads; ++t)
+    {
+        deques.emplace_back(new ft::work_stealing_deque<sum_task>());
+    }
+    deques[0]->push(sum_task{0, count});
+    std::atomic<std::uint64_t> remaining(count);
+    std::atomic<std::uint64_t> total(0);
+
+    auto worker = [&](size_t self) {
+        std::uint64_t local = 0;
+        std::uint64_t seed = self * 0x9e3779b97f4a7c15ull + 1;
+        sum_task task;
+        while (remaining.load(std::memory_order_acquire) != 0)
+        {
+            bool found = deques[self]->try_pop(task);
+            if (!found)
+            {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+                found = deques[seed % threads]->try_steal(task);
+            }
+            if (!found)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            while (task.end - task.begin > grain)
+            {
+                std::uint32_t middle = task.begin + (task.end - task.begin) / 2;
+                deques[self]->push(sum_task{middle, task.end});
+                task.end = middle;
+            }
+            std::uint64_t sum = 0;
+            for (std::uint32_t i = task.begin; i < task.end; ++i)
+            {
+                sum += values[i];
+            }
+            local += sum;
+            remaining.fetch_sub(task.end - task.begin, std::memory_order_release);
+        }
+        total.fetch_add(local);
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t)
+    {
+        workers.emplace_back(worker, t);
+    }
+    worker(0);
+    for (auto& thread : workers)
+    {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "fork/join sum with " << threads << " threads (" << (total.load() == 3ull * count ? "ok" : "WRONG") << "): "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms compute, total ";
+}
+
+void test_parallel_sum_1() { parallel_sum(1); }
+void test_parallel_sum_2() { parallel_sum(2); }
+void test_parallel_sum_4() { parallel_sum(4); }
+void test_parallel_sum_8() { parallel_sum(8); }
+
+void measure_func(const std::function<void()>& func)
+{
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+}
+
+int main()
+{
+    measure_func(test_vector_string_ft);
+    measure_func(test_vector_string_std);
+
+    measure_func(test_concurrent_append_1);
+    measure_func(test_concurrent_append_2);
+    measure_func(test_concurrent_append_4);
+    measure_func(test_concurrent_append_8);
+
+    measure_func(test_stack_contention_1);
+    measure_func(test_stack_contention_2);
+    measure_func(test_stack_contention_4);
+    measure_func(test_stack_contention_8);
+
+    measure_func(test_parallel_sum_1);
+    measure_func(test_parallel_sum_2);
+    measure_func(test_parallel_sum_4);
+    measure_func(test_parallel_sum_8);
+
+    measure_func(test_key_scan_pairs);
+    measure_func(test_key_scan_soa);
+    return 0;
+}
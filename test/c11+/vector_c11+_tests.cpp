@@ -0,0 +1,174 @@
+#include "vector_c11+.hpp"
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct Counted
+{
+    static int copies;
+    static int moves;
+
+    int value;
+
+    Counted(int val) : value(val) {}
+    Counted(const Counted& other) : value(other.value) { ++copies; }
+    Counted(Counted&& other) noexcept : value(other.value) { ++moves; }
+    Counted& operator=(const Counted& other) { value = other.value; ++copies; return *this; }
+    Counted& operator=(Counted&& other) noexcept { value = other.value; ++moves; return *this; }
+};
+
+int Counted::copies = 0;
+int Counted::moves = 0;
+
+struct ThrowingMove
+{
+    int value;
+
+    ThrowingMove(int val) : value(val) {}
+    ThrowingMove(const ThrowingMove& other) : value(other.value) { ++Counted::copies; }
+    ThrowingMove(ThrowingMove&& other) noexcept(false) : value(other.value) { ++Counted::moves; }
+};
+
+}
+
+class VectorC11Tests : public testing::Test
+{
+protected:
+    VectorC11Tests()
+    {
+        Counted::copies = 0;
+        Counted::moves = 0;
+    }
+};
+
+TEST_F(VectorC11Tests, InitializerListAndCompare)
+{
+    ft::vector<int> v = {1, 2, 3};
+    ASSERT_EQ(v.size(), 3);
+    ASSERT_EQ(v, (ft::vector<int>{1, 2, 3}));
+    ASSERT_LT(v, (ft::vector<int>{1, 2, 4}));
+
+    ft::vector<int> filled(5, 7);
+    ASSERT_EQ(filled, (ft::vector<int>{7, 7, 7, 7, 7}));
+}
+
+TEST_F(VectorC11Tests, MoveConstructAndAssign)
+{
+    ft::vector<std::string> v = {"a", "b", "c"};
+    const std::string* data = v.data();
+
+    ft::vector<std::string> moved(std::move(v));
+    ASSERT_TRUE(v.empty());
+    ASSERT_EQ(moved.data(), data);
+    ASSERT_EQ(moved[2], "c");
+
+    ft::vector<std::string> assigned = {"x"};
+    assigned = std::move(moved);
+    ASSERT_EQ(assigned.data(), data);
+    ASSERT_EQ(assigned.size(), 3);
+}
+
+TEST_F(VectorC11Tests, ReallocationMovesNoexceptTypes)
+{
+    ft::vector<Counted> v;
+    for (int i = 0; i < 100; ++i)
+    {
+        v.emplace_back(i);
+    }
+    ASSERT_EQ(Counted::copies, 0);
+    ASSERT_GT(Counted::moves, 0);
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(v[i].value, i);
+    }
+}
+
+TEST_F(VectorC11Tests, ReallocationCopiesThrowingMoveTypes)
+{
+    ft::vector<ThrowingMove> v;
+    for (int i = 0; i < 100; ++i)
+    {
+        v.emplace_back(i);
+    }
+    ASSERT_EQ(Counted::moves, 0);
+    ASSERT_GT(Counted::copies, 0);
+}
+
+TEST_F(VectorC11Tests, MoveOnlyElements)
+{
+    ft::vector<std::unique_ptr<int>> v;
+    for (int i = 0; i < 10; ++i)
+    {
+        v.push_back(std::unique_ptr<int>(new int(i)));
+    }
+    v.emplace(v.begin() + 3, new int(42));
+    v.insert(v.begin(), std::unique_ptr<int>(new int(-1)));
+    v.erase(v.begin() + 1);
+
+    std::vector<int> expected = {-1, 1, 2, 42, 3, 4, 5, 6, 7, 8, 9};
+    ASSERT_EQ(v.size(), expected.size());
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        ASSERT_EQ(*v[i], expected[i]);
+    }
+}
+
+TEST_F(VectorC11Tests, EmplaceOwnElement)
+{
+    ft::vector<std::string> v = {"a", "b", "c"};
+    v.reserve(10);
+    v.emplace(v.begin(), v.back());
+    v.insert(v.begin() + 1, 2, v[0]);
+    ASSERT_EQ(v, (ft::vector<std::string>{"c", "c", "c", "a", "b", "c"}));
+}
+
+TEST_F(VectorC11Tests, InsertRanges)
+{
+    std::vector<int> std_vec = {1, 2, 3, 4, 5};
+    ft::vector<int> v;
+    std::vector<int> expected;
+    for (int i = 0; i < 5; ++i)
+    {
+        v.insert(v.begin() + v.size() / 2, std_vec.begin(), std_vec.end());
+        expected.insert(expected.begin() + expected.size() / 2, std_vec.begin(), std_vec.end());
+        v.insert(v.end() - 1, std_vec.begin(), std_vec.begin() + 1);
+        expected.insert(expected.end() - 1, std_vec.begin(), std_vec.begin() + 1);
+    }
+
+    std::istringstream in("7 8 9");
+    v.insert(v.begin() + 2, std::istream_iterator<int>(in), std::istream_iterator<int>());
+    expected.insert(expected.begin() + 2, {7, 8, 9});
+
+    ASSERT_EQ(v.size(), expected.size());
+    ASSERT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+TEST_F(VectorC11Tests, ResizeAssignShrink)
+{
+    ft::vector<std::string> v;
+    v.resize(4);
+    ASSERT_EQ(v.size(), 4);
+    v.resize(6, "x");
+    ASSERT_EQ(v[5], "x");
+    v.resize(2);
+    ASSERT_EQ(v.size(), 2);
+
+    v.assign({"p", "q", "r", "s", "t", "u", "v"});
+    ASSERT_EQ(v.back(), "v");
+    v.assign(3, "z");
+    ASSERT_EQ(v, (ft::vector<std::string>{"z", "z", "z"}));
+
+    v.shrink_to_fit();
+    ASSERT_EQ(v.capacity(), 3);
+
+    ft::vector<std::string> copy(v);
+    copy.pop_back();
+    v = copy;
+    ASSERT_EQ(v.size(), 2);
+    ASSERT_THROW(v.at(2), std::out_of_range);
+}
@@ -0,0 +1,99 @@
+#include "work_stealing_deque.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(WorkStealingDequeTests, SingleThread)
+{
+    ft::work_stealing_deque<int> deque(4);
+    ASSERT_EQ(deque.capacity(), 4);
+    int out = 0;
+    ASSERT_FALSE(deque.try_pop(out));
+    ASSERT_FALSE(deque.try_steal(out));
+
+    for (int i = 0; i < 100; ++i)
+    {
+        deque.push(i);
+    }
+    ASSERT_EQ(deque.size(), 100);
+    ASSERT_EQ(deque.capacity(), 128);
+
+    ASSERT_TRUE(deque.try_pop(out));
+    ASSERT_EQ(out, 99);
+    ASSERT_TRUE(deque.try_steal(out));
+    ASSERT_EQ(out, 0);
+    ASSERT_TRUE(deque.try_steal(out));
+    ASSERT_EQ(out, 1);
+
+    for (int expected = 98; expected >= 2; --expected)
+    {
+        ASSERT_TRUE(deque.try_pop(out));
+        ASSERT_EQ(out, expected);
+    }
+    ASSERT_TRUE(deque.empty());
+    ASSERT_FALSE(deque.try_pop(out));
+    deque.push(7);
+    ASSERT_TRUE(deque.try_steal(out));
+    ASSERT_EQ(out, 7);
+}
+
+TEST(WorkStealingDequeTests, OwnerAndThieves)
+{
+    const int items = 200000;
+    ft::work_stealing_deque<int> deque(8);
+    std::vector<std::atomic<int>> seen(items);
+    std::atomic<int> taken(0);
+    std::atomic<bool> done(false);
+
+    auto record = [&](int value) {
+        seen[value].fetch_add(1);
+        taken.fetch_add(1);
+    };
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; ++t)
+    {
+        thieves.emplace_back([&]() {
+            int value;
+            while (!done.load())
+            {
+                if (deque.try_steal(value))
+                {
+                    record(value);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    int value;
+    for (int i = 0; i < items; ++i)
+    {
+        deque.push(i);
+        if (i % 3 == 0 && deque.try_pop(value))
+        {
+            record(value);
+        }
+    }
+    while (deque.try_pop(value))
+    {
+        record(value);
+    }
+    while (taken.load() < items)
+    {
+        std::this_thread::yield();
+    }
+    done.store(true);
+    for (auto& thief : thieves)
+    {
+        thief.join();
+    }
+    ASSERT_EQ(taken.load(), items);
+    ASSERT_TRUE(std::all_of(seen.begin(), seen.end(), [](const std::atomic<int>& hits) { return hits.load() == 1; }));
+}
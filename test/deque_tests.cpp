@@ -0,0 +1,166 @@
+#include "deque.h"
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+
+struct ThrowingCopy
+{
+    static int live;
+    static int copies_left;
+
+    int value;
+
+    ThrowingCopy(int v = 0) : value(v) { ++live; }
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+    {
+        if (copies_left-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+        ++live;
+    }
+    ThrowingCopy& operator=(const ThrowingCopy& other) { value = other.value; return *this; }
+    ~ThrowingCopy() { --live; }
+};
+
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = -1;
+
+}
+
+TEST(DequeTests, PushPopBothEnds)
+{
+    ft::deque<int> ft_deq;
+    std::deque<int> std_deq;
+    for (int i = 0; i < 10000; ++i)
+    {
+        if (i % 3 == 0)
+        {
+            ft_deq.push_front(i);
+            std_deq.push_front(i);
+        }
+        else
+        {
+            ft_deq.push_back(i);
+            std_deq.push_back(i);
+        }
+    }
+    ASSERT_EQ(ft_deq.size(), std_deq.size());
+    for (size_t i = 0; i < std_deq.size(); ++i)
+    {
+        ASSERT_EQ(ft_deq[i], std_deq[i]);
+    }
+    while (!std_deq.empty())
+    {
+        ASSERT_EQ(ft_deq.front(), std_deq.front());
+        ASSERT_EQ(ft_deq.back(), std_deq.back());
+        if (std_deq.size() % 2 == 0)
+        {
+            ft_deq.pop_front();
+            std_deq.pop_front();
+        }
+        else
+        {
+            ft_deq.pop_back();
+            std_deq.pop_back();
+        }
+    }
+    ASSERT_TRUE(ft_deq.empty());
+    ft_deq.push_front(1);
+    ft_deq.push_back(2);
+    ASSERT_EQ(ft_deq.front(), 1);
+    ASSERT_EQ(ft_deq.back(), 2);
+}
+
+TEST(DequeTests, StableReferences)
+{
+    ft::deque<std::string> deq;
+    deq.push_back("middle");
+    std::string* middle = &deq.front();
+    for (int i = 0; i < 5000; ++i)
+    {
+        deq.push_back(std::string(20, 'b'));
+        deq.push_front(std::string(20, 'f'));
+    }
+    ASSERT_EQ(middle, &deq[5000]);
+    ASSERT_EQ(*middle, "middle");
+}
+
+TEST(DequeTests, QueueThroughBlocks)
+{
+    ft::deque<int> deq;
+    for (int i = 0; i < 100000; ++i)
+    {
+        deq.push_back(i);
+        if (i % 4 != 0)
+        {
+            ASSERT_EQ(deq.front(), i - static_cast<int>(deq.size()) + 1);
+            deq.pop_front();
+        }
+    }
+    ASSERT_EQ(deq.size(), 25000);
+    ASSERT_EQ(deq.back(), 99999);
+    deq.shrink_to_fit();
+    deq.clear();
+    deq.shrink_to_fit();
+    deq.push_back(7);
+    deq.push_front(6);
+    ASSERT_EQ(deq[0], 6);
+    ASSERT_EQ(deq[1], 7);
+}
+
+TEST(DequeTests, IteratorsCopyCompare)
+{
+    ft::deque<int> deq;
+    for (int i = 0; i < 10; ++i)
+    {
+        deq.push_front(i);
+    }
+    ft::deque<int> copy(deq.begin(), deq.end());
+    ASSERT_TRUE(copy == deq);
+    ASSERT_EQ(deq.end() - deq.begin(), 10);
+    ASSERT_EQ(*deq.rbegin(), 0);
+    ASSERT_EQ(deq.begin()[3], 6);
+
+    copy.back() = 100;
+    ASSERT_TRUE(deq < copy);
+    copy.swap(deq);
+    ASSERT_EQ(deq.back(), 100);
+    ASSERT_EQ(copy.back(), 0);
+
+    ft::deque<int> assigned;
+    assigned = copy;
+    ASSERT_TRUE(assigned == copy);
+    assigned.assign(size_t(3), assigned[0]);
+    ASSERT_EQ(assigned.size(), 3);
+    ASSERT_EQ(assigned[2], 9);
+    ASSERT_THROW(assigned.at(3), std::out_of_range);
+    assigned.resize(6, 1);
+    ASSERT_EQ(assigned.back(), 1);
+}
+
+TEST(DequeTests, ThrowingConstructorsReleaseEverything)
+{
+    typedef ft::deque<ThrowingCopy> throwing_deque;
+    const size_t count = throwing_deque::block_size * 3;
+    ThrowingCopy::copies_left = -1;
+    {
+        throwing_deque deq(count, ThrowingCopy(1));
+        ASSERT_EQ(ThrowingCopy::live, static_cast<int>(count));
+
+        ThrowingCopy::copies_left = static_cast<int>(count) - 5; /// fails in the last block
+        ASSERT_THROW(throwing_deque copy(deq), std::runtime_error);
+        ThrowingCopy::copies_left = static_cast<int>(count) - 5;
+        ASSERT_THROW(throwing_deque copy(deq.begin(), deq.end()), std::runtime_error);
+        ThrowingCopy::copies_left = static_cast<int>(count) - 5;
+        ASSERT_THROW(throwing_deque filled(count, deq[0]), std::runtime_error);
+        ThrowingCopy::copies_left = -1;
+        ASSERT_EQ(ThrowingCopy::live, static_cast<int>(count));
+    }
+    ASSERT_EQ(ThrowingCopy::live, 0);
+}
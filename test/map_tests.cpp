@@ -303,3 +303,41 @@ TEST_F(MapTests, EqualRange)
     ASSERT_EQ(*left_4, create_pair(33, "range_1"));
     ASSERT_EQ(*right_4, create_pair(44, "range_2"));
 }
+
+TEST_F(MapTests, EraseIf)
+{
+    std_map_type expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        ft_map[i] = std::to_string(i);
+        expected[i] = std::to_string(i);
+    }
+
+    auto removed = ft::erase_if(ft_map, [](const ft_map_type::value_type& val) { return val.first % 100 == 7; });
+    for (auto it = expected.begin(); it != expected.end(); )
+    {
+        it = (it->first % 100 == 7) ? expected.erase(it) : ++it;
+    }
+    ASSERT_EQ(removed, 10);
+    ASSERT_EQ(ft_map.size(), expected.size());
+    check_ft_std_maps(expected);
+
+    removed = ft::erase_if(ft_map, [](const ft_map_type::value_type& val) { return val.first % 2 == 0; });
+    for (auto it = expected.begin(); it != expected.end(); )
+    {
+        it = (it->first % 2 == 0) ? expected.erase(it) : ++it;
+    }
+    ASSERT_EQ(removed, 500);
+    ASSERT_EQ(ft_map.size(), expected.size());
+    check_ft_std_maps(expected);
+
+    for (int i = 0; i < 1000; i += 3)
+    {
+        ft_map.erase(i);
+        expected.erase(i);
+        ft_map[-i] = "again";
+        expected[-i] = "again";
+    }
+    ASSERT_EQ(ft_map.size(), expected.size());
+    check_ft_std_maps(expected);
+}
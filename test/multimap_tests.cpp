@@ -0,0 +1,118 @@
+#include "multimap.h"
+#include <gtest/gtest.h>
+#include <map>
+
+class MultimapTests : public testing::Test
+{
+protected:
+    using ft_map_type = ft::multimap<int, std::string>;
+    using std_map_type = std::multimap<int, std::string>;
+
+protected:
+    MultimapTests()
+    {
+        for (const auto& [key, val] : std_map)
+        {
+            ft_map.insert(ft::make_pair(key, val));
+        }
+    }
+
+    ft_map_type ft_map;
+    std_map_type std_map = { {1, "a"}, {5, "b"}, {5, "c"}, {5, "d"}, {9, "e"} };
+
+    void check_ft_std_maps(const std_map_type& expected_map)
+    {
+        ASSERT_EQ(ft_map.size(), expected_map.size());
+        auto std_it = expected_map.begin();
+        for (const auto& [fst, sec] : ft_map)
+        {
+            ASSERT_EQ(fst, std_it->first);
+            ASSERT_EQ(sec, std_it->second);
+            ++std_it;
+        }
+    }
+};
+
+TEST_F(MultimapTests, InsertKeepsOrderOfEqualKeys)
+{
+    check_ft_std_maps(std_map);
+
+    ft_map.insert(ft::make_pair(5, std::string("f")));
+    std_map.insert({5, "f"});
+    check_ft_std_maps(std_map);
+}
+
+TEST_F(MultimapTests, CountAndEqualRange)
+{
+    ASSERT_EQ(ft_map.count(5), 3);
+    ASSERT_EQ(ft_map.count(1), 1);
+    ASSERT_EQ(ft_map.count(7), 0);
+
+    const auto& [first, last] = ft_map.equal_range(5);
+    ASSERT_EQ(first->second, "b");
+    ASSERT_EQ(last->first, 9);
+    ASSERT_EQ(ft_map.find(5), first);
+
+    const auto& [empty_first, empty_last] = ft_map.equal_range(7);
+    ASSERT_EQ(empty_first, empty_last);
+    ASSERT_EQ(empty_first->first, 9);
+}
+
+TEST_F(MultimapTests, InsertHint)
+{
+    auto it = ft_map.insert(ft_map.upper_bound(5), ft::make_pair(5, std::string("x")));
+    ASSERT_EQ(it->second, "x");
+    ASSERT_EQ((--it)->second, "d");
+    std_map.insert(std_map.upper_bound(5), {5, "x"});
+    check_ft_std_maps(std_map);
+
+    it = ft_map.insert(ft_map.find(5), ft::make_pair(5, std::string("y")));
+    ASSERT_EQ(it, ft_map.find(5));
+    std_map.insert(std_map.find(5), {5, "y"});
+    check_ft_std_maps(std_map);
+
+    ft_map.insert(ft_map.begin(), ft::make_pair(7, std::string("z")));
+    std_map.insert(std_map.begin(), {7, "z"});
+    check_ft_std_maps(std_map);
+}
+
+TEST_F(MultimapTests, Erase)
+{
+    auto it = ft_map.find(5);
+    ft_map.erase(++it);
+    std_map.erase(++std_map.find(5));
+    check_ft_std_maps(std_map);
+
+    ASSERT_EQ(ft_map.erase(5), 2);
+    ASSERT_EQ(ft_map.erase(5), 0);
+    std_map.erase(5);
+    check_ft_std_maps(std_map);
+
+    ft_map.erase(ft_map.begin(), ft_map.end());
+    ASSERT_TRUE(ft_map.empty());
+}
+
+TEST_F(MultimapTests, ManyDuplicates)
+{
+    ft::multimap<int, int> ft_mm;
+    std::multimap<int, int> std_mm;
+    for (int i = 0; i < 5000; ++i)
+    {
+        ft_mm.insert(ft_mm.end(), ft::make_pair(i / 100, i));
+        std_mm.insert(std_mm.end(), {i / 100, i});
+    }
+    for (int i = 0; i < 5000; i += 7)
+    {
+        ft_mm.erase(ft_mm.find(i % 50));
+        std_mm.erase(std_mm.find(i % 50));
+    }
+    ASSERT_EQ(ft_mm.size(), std_mm.size());
+    ASSERT_EQ(ft_mm.count(10), std_mm.count(10));
+
+    auto std_it = std_mm.begin();
+    for (auto it = ft_mm.begin(); it != ft_mm.end(); ++it, ++std_it)
+    {
+        ASSERT_EQ(it->first, std_it->first);
+        ASSERT_EQ(it->second, std_it->second);
+    }
+}
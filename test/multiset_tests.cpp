@@ -0,0 +1,82 @@
+#include "multiset.h"
+#include <gtest/gtest.h>
+#include <set>
+
+class MultisetTests : public testing::Test
+{
+protected:
+    using ft_set_type = ft::multiset<int>;
+    using std_set_type = std::multiset<int>;
+
+protected:
+    MultisetTests()
+    {
+        for (int val : std_set)
+        {
+            ft_set.insert(val);
+        }
+    }
+
+    ft_set_type ft_set;
+    std_set_type std_set = { 3, 1, 3, 7, 3, 1 };
+
+    void check_ft_std_sets(const std_set_type& expected_set)
+    {
+        ASSERT_EQ(ft_set.size(), expected_set.size());
+        ASSERT_TRUE(ft::equal(ft_set.begin(), ft_set.end(), expected_set.begin()));
+        ASSERT_TRUE(ft::equal(ft_set.rbegin(), ft_set.rend(), expected_set.rbegin()));
+    }
+};
+
+TEST_F(MultisetTests, InsertAndCount)
+{
+    check_ft_std_sets(std_set);
+    ASSERT_EQ(ft_set.count(3), 3);
+    ASSERT_EQ(ft_set.count(1), 2);
+    ASSERT_EQ(ft_set.count(4), 0);
+
+    ft_set.insert(ft_set.end(), 9);
+    ft_set.insert(ft_set.end(), 9);
+    std_set.insert(9);
+    std_set.insert(9);
+    check_ft_std_sets(std_set);
+}
+
+TEST_F(MultisetTests, Bounds)
+{
+    ASSERT_EQ(*ft_set.lower_bound(2), 3);
+    ASSERT_EQ(*ft_set.upper_bound(3), 7);
+    ASSERT_EQ(ft_set.upper_bound(7), ft_set.end());
+
+    const auto& [first, last] = ft_set.equal_range(3);
+    int cnt = 0;
+    for (auto it = first; it != last; ++it)
+    {
+        ASSERT_EQ(*it, 3);
+        ++cnt;
+    }
+    ASSERT_EQ(cnt, 3);
+}
+
+TEST_F(MultisetTests, EraseAndEraseIf)
+{
+    ASSERT_EQ(ft_set.erase(3), 3);
+    std_set.erase(3);
+    check_ft_std_sets(std_set);
+
+    ft_set.erase(ft_set.begin());
+    std_set.erase(std_set.begin());
+    check_ft_std_sets(std_set);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ft_set.insert(i % 10);
+        std_set.insert(i % 10);
+    }
+    ASSERT_EQ(ft::erase_if(ft_set, [](int val) { return val % 2 == 0; }), 50);
+    for (auto it = std_set.begin(); it != std_set.end(); )
+    {
+        it = (*it % 2 == 0) ? std_set.erase(it) : ++it;
+    }
+    check_ft_std_sets(std_set);
+}
@@ -0,0 +1,145 @@
+#include "segment_stack.h"
+#include "stack.h"
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+namespace
+{
+
+size_t chunk_allocations = 0;
+
+template <typename TType>
+struct CountingAllocator : std::allocator<TType>
+{
+    template <typename TOther>
+    struct rebind
+    {
+        typedef CountingAllocator<TOther> other;
+    };
+
+    CountingAllocator() {}
+
+    template <typename TOther>
+    CountingAllocator(const CountingAllocator<TOther>&) {}
+
+    TType* allocate(size_t count)
+    {
+        ++chunk_allocations;
+        return std::allocator<TType>::allocate(count);
+    }
+};
+
+}
+
+TEST(SegmentStackTests, PushPopAcrossChunks)
+{
+    ft::segment_stack<int, 4> s;
+    ASSERT_TRUE(s.empty());
+    for (int i = 0; i < 10; ++i)
+    {
+        s.push_back(i);
+        ASSERT_EQ(s.back(), i);
+    }
+    ASSERT_EQ(s.size(), 10);
+    ASSERT_EQ(s.capacity(), 12);
+
+    int expected = 0;
+    for (ft::segment_stack<int, 4>::const_iterator it = s.begin(); it != s.end(); ++it, ++expected)
+    {
+        ASSERT_EQ(*it, expected);
+    }
+    ASSERT_EQ(expected, 10);
+    for (ft::segment_stack<int, 4>::reverse_iterator it = s.rbegin(); it != s.rend(); ++it)
+    {
+        ASSERT_EQ(*it, --expected);
+    }
+
+    for (int i = 9; i >= 0; --i)
+    {
+        ASSERT_EQ(s.back(), i);
+        s.pop_back();
+    }
+    ASSERT_TRUE(s.empty());
+    ASSERT_TRUE(s.begin() == s.end());
+    ASSERT_EQ(s.capacity(), 12);
+
+    s.shrink_to_fit();
+    ASSERT_EQ(s.capacity(), 0);
+    s.push_back(7);
+    ASSERT_EQ(s.back(), 7);
+}
+
+TEST(SegmentStackTests, BoundaryOscillationNeverAllocates)
+{
+    ft::segment_stack<int, 8, CountingAllocator<int> > s;
+    s.reserve(20);
+    ASSERT_EQ(s.capacity(), 24);
+    chunk_allocations = 0;
+    for (int i = 0; i < 8; ++i)
+    {
+        s.push_back(i);
+    }
+    for (int i = 0; i < 1000; ++i)
+    {
+        s.push_back(i);
+        s.push_back(i);
+        s.pop_back();
+        s.pop_back();
+    }
+    for (int i = 8; i < 24; ++i)
+    {
+        s.push_back(i);
+    }
+    ASSERT_EQ(chunk_allocations, 0);
+    s.push_back(24);
+    ASSERT_EQ(chunk_allocations, 1);
+
+    s.clear();
+    ASSERT_TRUE(s.empty());
+    ASSERT_EQ(s.capacity(), 32);
+}
+
+TEST(SegmentStackTests, NonTrivial)
+{
+    ft::segment_stack<std::string, 4> s;
+    for (int i = 0; i < 9; ++i)
+    {
+        s.push_back(std::string(50, 'a' + i));
+    }
+    s.push_back(s.back()); /// aliasing its own element while stepping to a new chunk
+    ASSERT_EQ(s.back(), std::string(50, 'i'));
+
+    ft::segment_stack<std::string, 4> copy(s);
+    ASSERT_TRUE(copy == s);
+    copy.pop_back();
+    ASSERT_TRUE(copy < s);
+    ASSERT_TRUE(copy != s);
+
+    ft::segment_stack<std::string, 4> other;
+    other.push_back("x");
+    other.swap(copy);
+    ASSERT_EQ(copy.size(), 1);
+    ASSERT_EQ(other.size(), 9);
+    ASSERT_EQ(other.back(), std::string(50, 'i'));
+
+    other = s;
+    ASSERT_TRUE(other == s);
+}
+
+TEST(SegmentStackTests, AsStackContainer)
+{
+    ft::stack<int, ft::segment_stack<int, 16> > st;
+    for (int i = 0; i < 100; ++i)
+    {
+        st.push(i);
+    }
+    ASSERT_EQ(st.size(), 100);
+    ASSERT_EQ(st.top(), 99);
+    ft::stack<int, ft::segment_stack<int, 16> > copy(st);
+    ASSERT_TRUE(copy == st);
+    st.pop();
+    ASSERT_EQ(st.top(), 98);
+    ASSERT_TRUE(st < copy);
+}
@@ -0,0 +1,132 @@
+#include "segmented_vector.h"
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+
+struct ThrowingCopy
+{
+    static int live;
+    static int copies_left;
+
+    int value;
+
+    ThrowingCopy(int v = 0) : value(v) { ++live; }
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+    {
+        if (copies_left-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+        ++live;
+    }
+    ThrowingCopy& operator=(const ThrowingCopy& other) { value = other.value; return *this; }
+    ~ThrowingCopy() { --live; }
+};
+
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = -1;
+
+}
+
+TEST(SegmentedVectorTests, PushBackKeepsAddresses)
+{
+    ft::segmented_vector<int, 16> v;
+    v.push_back(0);
+    int* first = &v[0];
+    for (int i = 1; i < 1000; ++i)
+    {
+        v.push_back(i);
+    }
+    ASSERT_EQ(first, &v[0]);
+    ASSERT_EQ(v.size(), 1000);
+    ASSERT_EQ(v.capacity(), 1008);
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(v[i], i);
+    }
+    ASSERT_EQ(v.back(), 999);
+    ASSERT_THROW(v.at(1000), std::out_of_range);
+}
+
+TEST(SegmentedVectorTests, Iterators)
+{
+    ft::segmented_vector<int, 4> v;
+    for (int i = 0; i < 10; ++i)
+    {
+        v.push_back(i);
+    }
+    ft::segmented_vector<int, 4>::iterator it = v.begin();
+    ft::segmented_vector<int, 4>::iterator last = v.end();
+    v.push_back(10);
+    ASSERT_EQ(last - it, 10);
+    ASSERT_EQ(it[9], 9);
+    ASSERT_EQ(*(it + 5), 5);
+    ft::segmented_vector<int, 4>::const_iterator cit = it;
+    ASSERT_TRUE(cit == v.cbegin());
+    ASSERT_TRUE(cit < v.cend());
+
+    int expected = 10;
+    for (ft::segmented_vector<int, 4>::reverse_iterator rit = v.rbegin(); rit != v.rend(); ++rit, --expected)
+    {
+        ASSERT_EQ(*rit, expected);
+    }
+
+    ft::segmented_vector<int, 4> copy(v.begin(), v.end());
+    ASSERT_TRUE(copy == v);
+    copy.back() = 0;
+    ASSERT_TRUE(copy < v);
+}
+
+TEST(SegmentedVectorTests, NonTrivial)
+{
+    ft::segmented_vector<std::string, 8> v(size_t(20), "abc");
+    ft::segmented_vector<std::string, 8> copy(v);
+    copy.resize(5);
+    ASSERT_EQ(copy.size(), 5);
+    ASSERT_EQ(copy.capacity(), 24);
+    copy.shrink_to_fit();
+    ASSERT_EQ(copy.capacity(), 8);
+    v.pop_back();
+    v.assign(size_t(3), v[0]);
+    ASSERT_EQ(v.size(), 3);
+    ASSERT_EQ(v[2], "abc");
+
+    copy = v;
+    ASSERT_TRUE(copy == v);
+    copy.push_back("x");
+    v.swap(copy);
+    ASSERT_EQ(v.size(), 4);
+    ASSERT_EQ(copy.size(), 3);
+    v.clear();
+    ASSERT_TRUE(v.empty());
+    ASSERT_EQ(v.capacity(), 8);
+}
+
+TEST(SegmentedVectorTests, ThrowingConstructorsReleaseBlocks)
+{
+    typedef ft::segmented_vector<ThrowingCopy, 4> throwing_vector;
+    ThrowingCopy::copies_left = -1;
+    {
+        throwing_vector v(10, ThrowingCopy(1));
+        ASSERT_EQ(ThrowingCopy::live, 10);
+
+        ThrowingCopy::copies_left = 9; /// fails in the third block
+        ASSERT_THROW(throwing_vector copy(v), std::runtime_error);
+        ThrowingCopy::copies_left = 9;
+        ASSERT_THROW(throwing_vector copy(v.begin(), v.end()), std::runtime_error);
+        ThrowingCopy::copies_left = 9;
+        ASSERT_THROW(throwing_vector filled(10, v[0]), std::runtime_error);
+
+        throwing_vector assigned(3, ThrowingCopy(2));
+        ThrowingCopy::copies_left = 9;
+        ASSERT_THROW(assigned = v, std::runtime_error);
+        ASSERT_EQ(assigned.size(), 8); /// the two whole blocks that were copied stay
+        ThrowingCopy::copies_left = -1;
+        ASSERT_EQ(ThrowingCopy::live, 18);
+    }
+    ASSERT_EQ(ThrowingCopy::live, 0);
+}
@@ -281,3 +281,63 @@ TEST_F(SetTests, EqualRange)
     ASSERT_EQ(*left_4, 33);
     ASSERT_EQ(*right_4, 44);
 }
+
+TEST_F(SetTests, ThreadedIteration)
+{
+    ft::set<int, ft::less<int>, std::allocator<int>, true> threaded;
+    std_set_type expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const int val = (i * 7919) % 1009;
+        threaded.insert(val);
+        expected.insert(val);
+    }
+    for (int i = 0; i < 1000; i += 3)
+    {
+        threaded.erase(i);
+        expected.erase(i);
+    }
+    ASSERT_EQ(threaded.size(), expected.size());
+    ASSERT_TRUE(ft::equal(threaded.begin(), threaded.end(), expected.begin()));
+    ASSERT_TRUE(ft::equal(threaded.rbegin(), threaded.rend(), expected.rbegin()));
+
+    ft::set<int, ft::less<int>, std::allocator<int>, true> copy(threaded);
+    threaded.clear();
+    ASSERT_TRUE(ft::equal(copy.begin(), copy.end(), expected.begin()));
+    ASSERT_TRUE(ft::equal(copy.rbegin(), copy.rend(), expected.rbegin()));
+}
+
+TEST_F(SetTests, EraseIf)
+{
+    ft::set<int, ft::less<int>, std::allocator<int>, true> threaded;
+    std_set_type expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        threaded.insert(i);
+        expected.insert(i);
+    }
+
+    auto removed = ft::erase_if(threaded, [](int val) { return val % 4 != 0; });
+    for (auto it = expected.begin(); it != expected.end(); )
+    {
+        it = (*it % 4 != 0) ? expected.erase(it) : ++it;
+    }
+    ASSERT_EQ(removed, 750);
+    ASSERT_TRUE(ft::equal(threaded.begin(), threaded.end(), expected.begin()));
+    ASSERT_TRUE(ft::equal(threaded.rbegin(), threaded.rend(), expected.rbegin()));
+
+    for (int i = 0; i < 1000; i += 8)
+    {
+        threaded.erase(i);
+        expected.erase(i);
+        threaded.insert(i + 1);
+        expected.insert(i + 1);
+    }
+    ASSERT_EQ(threaded.size(), expected.size());
+    ASSERT_TRUE(ft::equal(threaded.begin(), threaded.end(), expected.begin()));
+    ASSERT_TRUE(ft::equal(threaded.rbegin(), threaded.rend(), expected.rbegin()));
+
+    ASSERT_EQ(ft::erase_if(threaded, [](int) { return true; }), expected.size());
+    ASSERT_TRUE(threaded.empty());
+    ASSERT_EQ(threaded.begin(), threaded.end());
+}
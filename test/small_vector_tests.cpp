@@ -0,0 +1,230 @@
+#include "small_vector.h"
+#include <gtest/gtest.h>
+
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class SmallVectorTests : public testing::Test
+{
+protected:
+    typedef ft::small_vector<int, 4> small_int;
+    typedef ft::small_vector<std::string, 3> small_str;
+
+    template <typename TSmall, typename TExpected>
+    void check_equal(const TSmall& small, const TExpected& expected)
+    {
+        ASSERT_EQ(small.size(), expected.size());
+        ASSERT_TRUE(ft::equal(small.begin(), small.end(), expected.begin()));
+    }
+};
+
+TEST_F(SmallVectorTests, StaysInlineUpToCapacity)
+{
+    small_int v;
+    ASSERT_TRUE(v.is_inline());
+    ASSERT_EQ(v.capacity(), 4);
+    for (int i = 0; i < 4; ++i)
+    {
+        v.push_back(i);
+    }
+    ASSERT_TRUE(v.is_inline());
+
+    v.push_back(4);
+    ASSERT_FALSE(v.is_inline());
+    ASSERT_GE(v.capacity(), 5);
+    check_equal(v, std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+TEST_F(SmallVectorTests, InsertErase)
+{
+    small_str v;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 6; ++i)
+    {
+        v.insert(v.begin() + v.size() / 2, std::string(20, 'a' + i));
+        expected.insert(expected.begin() + expected.size() / 2, std::string(20, 'a' + i));
+    }
+    v.insert(v.begin(), 2, v.back());
+    expected.insert(expected.begin(), 2, expected.back());
+    check_equal(v, expected);
+
+    v.erase(v.begin() + 1, v.begin() + 4);
+    expected.erase(expected.begin() + 1, expected.begin() + 4);
+    v.erase(v.begin());
+    expected.erase(expected.begin());
+    check_equal(v, expected);
+
+    v.resize(2);
+    expected.resize(2);
+    check_equal(v, expected);
+}
+
+TEST_F(SmallVectorTests, CopyAndAssign)
+{
+    small_str inline_vec(2, "x");
+    small_str heap_vec(5, "y");
+
+    small_str copy(heap_vec);
+    check_equal(copy, std::vector<std::string>(5, "y"));
+    copy = inline_vec;
+    check_equal(copy, std::vector<std::string>(2, "x"));
+    ASSERT_EQ(copy, inline_vec);
+    ASSERT_NE(copy, heap_vec);
+}
+
+TEST_F(SmallVectorTests, SwapCombinations)
+{
+    small_str a(2, "a");
+    small_str b(3, "b");
+    a.swap(b);
+    check_equal(a, std::vector<std::string>(3, "b"));
+    check_equal(b, std::vector<std::string>(2, "a"));
+
+    small_str heap(6, "h");
+    a.swap(heap);
+    ASSERT_FALSE(a.is_inline());
+    ASSERT_TRUE(heap.is_inline());
+    check_equal(a, std::vector<std::string>(6, "h"));
+    check_equal(heap, std::vector<std::string>(3, "b"));
+
+    heap.swap(a);
+    ASSERT_TRUE(a.is_inline());
+    check_equal(heap, std::vector<std::string>(6, "h"));
+
+    small_str other_heap(8, "o");
+    ft::swap(heap, other_heap);
+    check_equal(heap, std::vector<std::string>(8, "o"));
+    check_equal(other_heap, std::vector<std::string>(6, "h"));
+}
+
+TEST_F(SmallVectorTests, EraseIf)
+{
+    small_int v;
+    for (int i = 0; i < 10; ++i)
+    {
+        v.push_back(i);
+    }
+    ASSERT_EQ(ft::erase_if(v, [](int val) { return val % 2 == 1; }), 5);
+    check_equal(v, std::vector<int>({0, 2, 4, 6, 8}));
+}
+
+TEST_F(SmallVectorTests, RangesOfAnyIterator)
+{
+    int arr[] = {1, 2, 3, 4, 5};
+    small_int from_pointers(arr, arr + 3);
+    check_equal(from_pointers, std::vector<int>({1, 2, 3}));
+
+    std::list<int> values(arr, arr + 5);
+    small_int from_list(values.begin(), values.end());
+    check_equal(from_list, std::vector<int>({1, 2, 3, 4, 5}));
+
+    from_pointers.insert(from_pointers.begin() + 1, values.begin(), values.end());
+    check_equal(from_pointers, std::vector<int>({1, 1, 2, 3, 4, 5, 2, 3}));
+    from_list.assign(arr + 3, arr + 5);
+    check_equal(from_list, std::vector<int>({4, 5}));
+}
+
+namespace
+{
+
+struct ThrowingCopy
+{
+    static int live;
+    static int copies_left;
+
+    int value;
+
+    ThrowingCopy(int v = 0) : value(v) { ++live; }
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+    {
+        if (copies_left-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+        ++live;
+    }
+    ThrowingCopy& operator=(const ThrowingCopy& other) { value = other.value; return *this; }
+    ~ThrowingCopy() { --live; }
+    bool operator==(const ThrowingCopy& other) const { return value == other.value; }
+};
+
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = -1;
+
+}
+
+TEST_F(SmallVectorTests, FailedInsertRestoresElements)
+{
+    ThrowingCopy::copies_left = -1;
+    {
+        ft::small_vector<ThrowingCopy, 8> v;
+        for (int i = 0; i < 3; ++i)
+        {
+            v.push_back(ThrowingCopy(i));
+        }
+        ThrowingCopy inserted(9);
+        std::vector<ThrowingCopy> expected(&v[0], &v[0] + v.size());
+
+        ThrowingCopy::copies_left = 5; /// val, three shifted elements, then the second copy into the gap fails
+        ASSERT_THROW(v.insert(v.begin(), 2, inserted), std::runtime_error);
+        check_equal(v, expected);
+
+        ThrowingCopy range[] = {ThrowingCopy(7), ThrowingCopy(8)};
+        ThrowingCopy::copies_left = 3; /// two shifted elements, then the second range copy fails
+        ASSERT_THROW(v.insert(v.begin() + 1, range, range + 2), std::runtime_error);
+        check_equal(v, expected);
+        ThrowingCopy::copies_left = -1;
+    }
+    ASSERT_EQ(ThrowingCopy::live, 0);
+}
+
+TEST_F(SmallVectorTests, ThrowingCopiesKeepElementsCounted)
+{
+    ThrowingCopy::copies_left = -1;
+    {
+        typedef ft::small_vector<ThrowingCopy, 2> small_throwing;
+        small_throwing v;
+        for (int i = 0; i < 2; ++i)
+        {
+            v.push_back(ThrowingCopy(i));
+        }
+        ThrowingCopy::copies_left = 2; /// the copy of val, one element, then moving the second one fails
+        ASSERT_THROW(v.push_back(ThrowingCopy(2)), std::runtime_error);
+        ASSERT_TRUE(v.is_inline());
+        ASSERT_EQ(v.size(), 2);
+        ASSERT_EQ(v[1].value, 1);
+
+        ThrowingCopy::copies_left = -1;
+        for (int i = 2; i < 6; ++i)
+        {
+            v.push_back(ThrowingCopy(i));
+        }
+        ThrowingCopy::copies_left = 3;
+        ASSERT_THROW(small_throwing copy(v), std::runtime_error);
+        ASSERT_EQ(ThrowingCopy::live, 6);
+
+        ThrowingCopy::copies_left = 1; /// erasing element 1 moves four elements down, the second move fails
+        ASSERT_THROW(v.erase(v.begin() + 1), std::runtime_error);
+        ASSERT_EQ(v.size(), 2); /// the intact prefix is kept, the stranded elements are gone
+        ASSERT_EQ(v[1].value, 2);
+        ThrowingCopy::copies_left = -1;
+        ASSERT_EQ(ThrowingCopy::live, 2);
+
+        small_throwing inline_vec;
+        inline_vec.push_back(ThrowingCopy(7));
+        small_throwing other;
+        other.push_back(ThrowingCopy(8));
+        other.push_back(ThrowingCopy(9));
+        ThrowingCopy::copies_left = 1; /// one prefix swap, then moving other's extra element fails
+        ASSERT_THROW(inline_vec.swap(other), std::runtime_error);
+        ASSERT_EQ(inline_vec.size(), 1);
+        ASSERT_EQ(other.size(), 2);
+        ThrowingCopy::copies_left = -1;
+        inline_vec.swap(other);
+        ASSERT_EQ(inline_vec.size(), 2);
+        ASSERT_EQ(other.size(), 1);
+    }
+    ASSERT_EQ(ThrowingCopy::live, 0);
+}
@@ -1,4 +1,5 @@
 #include "stack.h"
+#include "vector.h"
 #include <gtest/gtest.h>
 
 #include <vector>
@@ -0,0 +1,188 @@
+#include "static_vector.h"
+#include <gtest/gtest.h>
+
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class StaticVectorTests : public testing::Test
+{
+protected:
+    template <typename TStatic, typename TExpected>
+    void check_equal(const TStatic& v, const TExpected& expected)
+    {
+        ASSERT_EQ(v.size(), expected.size());
+        ASSERT_TRUE(ft::equal(v.begin(), v.end(), expected.begin()));
+    }
+};
+
+TEST_F(StaticVectorTests, TrivialTypesStayTrivial)
+{
+    ASSERT_TRUE((std::is_trivially_copyable<ft::static_vector<int, 8> >::value));
+    ASSERT_FALSE((std::is_trivially_copyable<ft::static_vector<std::string, 8> >::value));
+    ASSERT_EQ(sizeof(ft::static_vector<char, 8>), sizeof(std::size_t) + 8);
+}
+
+TEST_F(StaticVectorTests, PushInsertErase)
+{
+    ft::static_vector<std::string, 10> v;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 6; ++i)
+    {
+        v.insert(v.begin() + v.size() / 2, std::string(20, 'a' + i));
+        expected.insert(expected.begin() + expected.size() / 2, std::string(20, 'a' + i));
+    }
+    v.insert(v.begin(), 2, v.back());
+    expected.insert(expected.begin(), 2, expected.back());
+    check_equal(v, expected);
+
+    v.erase(v.begin() + 1, v.begin() + 4);
+    expected.erase(expected.begin() + 1, expected.begin() + 4);
+    v.pop_back();
+    expected.pop_back();
+    check_equal(v, expected);
+    ASSERT_EQ(v.capacity(), 10);
+}
+
+TEST_F(StaticVectorTests, OverflowThrows)
+{
+    ft::static_vector<int, 3> v(3, 1);
+    ASSERT_TRUE(v.full());
+    ASSERT_THROW(v.push_back(4), std::length_error);
+    ASSERT_THROW(v.insert(v.begin(), 1, 0), std::length_error);
+    ASSERT_THROW(v.reserve(4), std::length_error);
+    ASSERT_THROW(v.at(3), std::out_of_range);
+    ASSERT_EQ(v.size(), 3);
+}
+
+TEST_F(StaticVectorTests, CopyAndSwap)
+{
+    ft::static_vector<std::string, 5> a(2, "a");
+    ft::static_vector<std::string, 5> b(4, "b");
+
+    ft::static_vector<std::string, 5> copy(b);
+    ASSERT_EQ(copy, b);
+    copy = a;
+    ASSERT_EQ(copy, a);
+
+    a.swap(b);
+    check_equal(a, std::vector<std::string>(4, "b"));
+    check_equal(b, std::vector<std::string>(2, "a"));
+    ft::swap(a, b);
+    check_equal(a, std::vector<std::string>(2, "a"));
+    check_equal(b, std::vector<std::string>(4, "b"));
+}
+
+TEST_F(StaticVectorTests, EraseIf)
+{
+    ft::static_vector<int, 8> v;
+    for (int i = 1; i <= 6; ++i)
+    {
+        v.push_back(i);
+    }
+    ft::static_vector<int, 8> copy(v.begin(), v.end());
+    ASSERT_EQ(copy, v);
+    ASSERT_EQ(ft::erase_if(v, [](int val) { return val > 3; }), 3);
+    check_equal(v, std::vector<int>({1, 2, 3}));
+}
+
+TEST_F(StaticVectorTests, RangesOfAnyIterator)
+{
+    int arr[] = {1, 2, 3, 4, 5};
+    ft::static_vector<int, 8> from_pointers(arr, arr + 3);
+    check_equal(from_pointers, std::vector<int>({1, 2, 3}));
+
+    std::list<int> values(arr, arr + 5);
+    ft::static_vector<int, 8> from_list(values.begin(), values.end());
+    check_equal(from_list, std::vector<int>({1, 2, 3, 4, 5}));
+
+    from_pointers.insert(from_pointers.begin() + 1, values.begin(), values.end());
+    check_equal(from_pointers, std::vector<int>({1, 1, 2, 3, 4, 5, 2, 3}));
+    ASSERT_THROW(from_pointers.insert(from_pointers.end(), arr, arr + 1), std::length_error);
+    from_list.assign(arr + 3, arr + 5);
+    check_equal(from_list, std::vector<int>({4, 5}));
+}
+
+namespace
+{
+
+struct ThrowingCopy
+{
+    static int live;
+    static int copies_left;
+
+    int value;
+
+    ThrowingCopy(int v = 0) : value(v) { ++live; }
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+    {
+        if (copies_left-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+        ++live;
+    }
+    ThrowingCopy& operator=(const ThrowingCopy& other) { value = other.value; return *this; }
+    ~ThrowingCopy() { --live; }
+    bool operator==(const ThrowingCopy& other) const { return value == other.value; }
+};
+
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = -1;
+
+}
+
+TEST_F(StaticVectorTests, FailedInsertRestoresElements)
+{
+    ThrowingCopy::copies_left = -1;
+    {
+        ft::static_vector<ThrowingCopy, 8> v;
+        for (int i = 0; i < 3; ++i)
+        {
+            v.push_back(ThrowingCopy(i));
+        }
+        ThrowingCopy inserted(9);
+        std::vector<ThrowingCopy> expected(v.data(), v.data() + v.size());
+
+        ThrowingCopy::copies_left = 5; /// val, three shifted elements, then the second copy into the gap fails
+        ASSERT_THROW(v.insert(v.begin(), 2, inserted), std::runtime_error);
+        check_equal(v, expected);
+
+        ThrowingCopy range[] = {ThrowingCopy(7), ThrowingCopy(8)};
+        ThrowingCopy::copies_left = 3; /// two shifted elements, then the second range copy fails
+        ASSERT_THROW(v.insert(v.begin() + 1, range, range + 2), std::runtime_error);
+        check_equal(v, expected);
+        ThrowingCopy::copies_left = -1;
+    }
+    ASSERT_EQ(ThrowingCopy::live, 0);
+}
+
+TEST_F(StaticVectorTests, ThrowingEraseAndSwapKeepElementsCounted)
+{
+    ThrowingCopy::copies_left = -1;
+    {
+        ft::static_vector<ThrowingCopy, 8> v;
+        ft::static_vector<ThrowingCopy, 8> other;
+        for (int i = 0; i < 5; ++i)
+        {
+            v.push_back(ThrowingCopy(i));
+        }
+        other.push_back(ThrowingCopy(10));
+
+        ThrowingCopy::copies_left = 1; /// the common prefix swaps, then moving the extra elements fails
+        ASSERT_THROW(v.swap(other), std::runtime_error);
+        ThrowingCopy::copies_left = -1;
+        ASSERT_EQ(ThrowingCopy::live, static_cast<int>(v.size() + other.size()));
+
+        ThrowingCopy::copies_left = 1; /// erasing the front moves the rest down, the second move fails
+        ASSERT_THROW(v.erase(v.begin()), std::runtime_error);
+        ThrowingCopy::copies_left = -1;
+        ASSERT_EQ(ThrowingCopy::live, static_cast<int>(v.size() + other.size()));
+
+        v.swap(other);
+        ASSERT_EQ(ThrowingCopy::live, static_cast<int>(v.size() + other.size()));
+    }
+    ASSERT_EQ(ThrowingCopy::live, 0);
+}
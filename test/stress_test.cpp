@@ -2,13 +2,22 @@
 #include "stack.h"
 #include "map.h"
 #include "set.h"
+#include "multimap.h"
+#include "small_vector.h"
+#include "segmented_vector.h"
+#include "back_insert_buffer.h"
+#include "segment_stack.h"
 
 #include <vector>
 #include <stack>
 #include <map>
 #include <set>
 
+#include <algorithm>
 #include <chrono>
+#include <list>
+#include <sstream>
+#include <iterator>
 #include <functional>
 #include <iostream>
 
@@ -60,6 +69,97 @@ void test_map_std()
     std::cout << __FUNCTION__ << ": ";
 }
 
+template <typename TSet>
+void scan_set(const char* name)
+{
+    TSet st;
+    for (auto i = 0; i < 10'000'000; ++i)
+    {
+        st.insert(i);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    size_t sum = 0;
+    for (typename TSet::const_iterator it = st.begin(); it != st.end(); ++it)
+    {
+        sum += *it;
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << name << " (sum " << sum << "), scan only "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms: ";
+}
+
+void test_set_scan_ft()
+{
+    scan_set<ft::set<size_t> >(__FUNCTION__);
+}
+
+void test_set_scan_ft_threaded()
+{
+    scan_set<ft::set<size_t, ft::less<size_t>, std::allocator<size_t>, true> >(__FUNCTION__);
+}
+
+void test_set_scan_std()
+{
+    scan_set<std::set<size_t> >(__FUNCTION__);
+}
+
+void test_map_sweep_ft()
+{
+    ft::map<size_t, size_t> m;
+    for (auto i = 0; i < 1'000'000; ++i)
+    {
+        m[i] = i;
+    }
+
+    for (ft::map<size_t, size_t>::iterator it = m.begin(); it != m.end(); )
+    {
+        if (it->second % 3 == 0)
+        {
+            m.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    std::cout << __FUNCTION__ << ": ";
+}
+
+void test_map_erase_if_ft()
+{
+    ft::map<size_t, size_t> m;
+    for (auto i = 0; i < 1'000'000; ++i)
+    {
+        m[i] = i;
+    }
+
+    ft::erase_if(m, [](const ft::map<size_t, size_t>::value_type& val) { return val.second % 3 == 0; });
+    std::cout << __FUNCTION__ << ": ";
+}
+
+void test_multimap_append_ft()
+{
+    ft::multimap<size_t, size_t> m;
+    for (auto i = 0; i < 1'000'000; ++i)
+    {
+        m.insert(m.end(), ft::make_pair(i / 1000, i));
+    }
+
+    std::cout << __FUNCTION__ << " (count " << m.count(500) << "): ";
+}
+
+void test_multimap_append_std()
+{
+    std::multimap<size_t, size_t> m;
+    for (auto i = 0; i < 1'000'000; ++i)
+    {
+        m.insert(m.end(), std::make_pair(i / 1000, i));
+    }
+
+    std::cout << __FUNCTION__ << " (count " << m.count(500) << "): ";
+}
+
 void test_stack_ft()
 {
     ft::stack<std::string> s;
@@ -72,6 +172,18 @@ void test_stack_ft()
     std::cout << __FUNCTION__ << ": ";
 }
 
+void test_stack_vector_ft()
+{
+    ft::stack<std::string, ft::vector<std::string> > s;
+    for (auto i = 0; i < 1'000'000; ++i)
+    {
+        s.push(std::string(1000, 'f'));
+    }
+
+    s.pop();
+    std::cout << __FUNCTION__ << ": ";
+}
+
 void test_stack_std()
 {
     std::stack<std::string> s;
@@ -108,12 +220,457 @@ void test_vector_std()
     std::cout << __FUNCTION__ << ": ";
 }
 
+struct Buffer
+{
+    int idx;
+    char buff[4096];
+};
+
+template <typename TContainer>
+void buffer_stack(const char* name)
+{
+    ft::stack<Buffer, TContainer> s;
+    Buffer buffer = {};
+    for (auto i = 0; i < 100'000; ++i)
+    {
+        buffer.idx = i;
+        s.push(buffer);
+    }
+    while (s.size() > 1)
+    {
+        s.pop();
+    }
+    std::cout << name << " (top " << s.top().idx << "): ";
+}
+
+void test_stack_buffer_vector_ft() { buffer_stack<ft::vector<Buffer> >(__FUNCTION__); }
+void test_stack_buffer_deque_ft() { buffer_stack<ft::deque<Buffer> >(__FUNCTION__); }
+
+template <typename TVector>
+void grow_vector()
+{
+    TVector v;
+    for (auto i = 0; i < 100'000; ++i)
+    {
+        v.push_back(typename TVector::value_type());
+    }
+}
+
+template <typename TVector>
+void insert_front_vector()
+{
+    TVector v;
+    for (auto i = 0; i < 20'000; ++i)
+    {
+        v.insert(v.begin(), typename TVector::value_type());
+    }
+}
+
+template <typename TVector>
+void erase_front_vector()
+{
+    TVector v(size_t(20'000), typename TVector::value_type());
+    while (!v.empty())
+    {
+        v.erase(v.begin());
+    }
+}
+
+template <typename TVector>
+void copy_vector()
+{
+    TVector v(size_t(20'000), typename TVector::value_type());
+    for (auto i = 0; i < 10; ++i)
+    {
+        TVector copy(v);
+    }
+}
+
+void test_vector_int_grow_ft() { grow_vector<ft::vector<int> >(); std::cout << __FUNCTION__ << ": "; }
+void test_vector_int_grow_std() { grow_vector<std::vector<int> >(); std::cout << __FUNCTION__ << ": "; }
+void test_vector_int_insert_ft() { insert_front_vector<ft::vector<int> >(); std::cout << __FUNCTION__ << ": "; }
+void test_vector_int_insert_std() { insert_front_vector<std::vector<int> >(); std::cout << __FUNCTION__ << ": "; }
+void test_vector_int_erase_ft() { erase_front_vector<ft::vector<int> >(); std::cout << __FUNCTION__ << ": "; }
+void test_vector_int_erase_std() { erase_front_vector<std::vector<int> >(); std::cout << __FUNCTION__ << ": "; }
+
+void test_vector_buffer_grow_ft() { grow_vector<ft::vector<Buffer> >(); std::cout << __FUNCTION__ << ": "; }
+void test_vector_buffer_grow_std() { grow_vector<std::vector<Buffer> >(); std::cout << __FUNCTION__ << ": "; }
+void test_vector_buffer_copy_ft() { copy_vector<ft::vector<Buffer> >(); std::cout << __FUNCTION__ << ": "; }
+void test_vector_buffer_copy_std() { copy_vector<std::vector<Buffer> >(); std::cout << __FUNCTION__ << ": "; }
+
+void test_vector_huge_grow_ft()
+{
+    ft::vector<size_t> v;
+    for (size_t i = 0; i < 100'000'000; ++i)
+    {
+        v.push_back(i);
+    }
+    std::cout << __FUNCTION__ << ": ";
+}
+
+void test_vector_huge_grow_ft_page()
+{
+    ft::vector<size_t, ft::page_allocator<size_t> > v;
+    for (size_t i = 0; i < 100'000'000; ++i)
+    {
+        v.push_back(i);
+    }
+    std::cout << __FUNCTION__ << ": ";
+}
+
+void test_vector_huge_grow_ft_malloc()
+{
+    ft::vector<size_t, ft::malloc_allocator<size_t> > v;
+    for (size_t i = 0; i < 100'000'000; ++i)
+    {
+        v.push_back(i);
+    }
+    std::cout << __FUNCTION__ << ": ";
+}
+
+struct AllocStats
+{
+    static size_t current;
+    static size_t peak;
+    static size_t allocations;
+};
+
+size_t AllocStats::current = 0;
+size_t AllocStats::peak = 0;
+size_t AllocStats::allocations = 0;
+
+template <typename TType>
+struct counting_allocator : std::allocator<TType>
+{
+    template <typename TOther>
+    struct rebind
+    {
+        typedef counting_allocator<TOther> other;
+    };
+
+    counting_allocator() {}
+
+    template <typename TOther>
+    counting_allocator(const counting_allocator<TOther>&) {}
+
+    TType* allocate(size_t n)
+    {
+        AllocStats::current += n * sizeof(TType);
+        AllocStats::peak = std::max(AllocStats::peak, AllocStats::current);
+        ++AllocStats::allocations;
+        return std::allocator<TType>::allocate(n);
+    }
+
+    void deallocate(TType* p, size_t n)
+    {
+        AllocStats::current -= n * sizeof(TType);
+        std::allocator<TType>::deallocate(p, n);
+    }
+};
+
+template <typename TGrowth>
+void append_with_policy(const char* name)
+{
+    AllocStats::current = AllocStats::peak = AllocStats::allocations = 0;
+    {
+        ft::vector<size_t, counting_allocator<size_t>, TGrowth> v;
+        for (size_t i = 0; i < 100'000; ++i)
+        {
+            v.push_back(i);
+        }
+        for (size_t i = 0; i < 100; ++i)
+        {
+            v.resize(v.size() + 1000);
+        }
+    }
+    std::cout << name << ": peak " << AllocStats::peak / 1024 << " KB, "
+              << AllocStats::allocations << " allocations, ";
+}
+
+void test_growth_doubling() { append_with_policy<ft::growth_doubling>(__FUNCTION__); }
+void test_growth_one_and_half() { append_with_policy<ft::growth_one_and_half>(__FUNCTION__); }
+void test_growth_size_class() { append_with_policy<ft::growth_size_class>(__FUNCTION__); }
+void test_growth_exact() { append_with_policy<ft::growth_exact>(__FUNCTION__); }
+
+template <typename TVector>
+void short_vectors(const char* name)
+{
+    AllocStats::current = AllocStats::peak = AllocStats::allocations = 0;
+    size_t total = 0;
+    for (size_t i = 0; i < 1'000'000; ++i)
+    {
+        TVector v;
+        for (size_t j = 0; j < i % 8; ++j)
+        {
+            v.push_back(j);
+        }
+        total += v.size();
+    }
+    std::cout << name << " (" << total << " elements): " << AllocStats::allocations << " allocations, ";
+}
+
+void test_short_vector_ft() { short_vectors<ft::vector<size_t, counting_allocator<size_t> > >(__FUNCTION__); }
+void test_short_small_vector_ft() { short_vectors<ft::small_vector<size_t, 8, counting_allocator<size_t> > >(__FUNCTION__); }
+
+void test_vector_refill_ft()
+{
+    ft::vector<size_t, counting_allocator<size_t> > source(size_t(1000), 1);
+    ft::vector<size_t, counting_allocator<size_t> > scratch;
+    AllocStats::allocations = 0;
+    for (auto i = 0; i < 100'000; ++i)
+    {
+        scratch = source;
+        scratch.assign(size_t(500 + i % 500), i);
+    }
+    std::cout << __FUNCTION__ << " (" << AllocStats::allocations << " allocations): ";
+}
+
+template <typename TVector>
+void range_construct(const char* name)
+{
+    std::list<size_t> lst;
+    std::ostringstream out;
+    for (size_t i = 0; i < 1'000'000; ++i)
+    {
+        lst.push_back(i);
+        out << i << ' ';
+    }
+    std::istringstream in(out.str());
+
+    AllocStats::allocations = 0;
+    TVector from_list(lst.begin(), lst.end());
+    TVector from_stream((std::istream_iterator<size_t>(in)), std::istream_iterator<size_t>());
+    TVector copy(from_list.begin(), from_list.end());
+    std::cout << name << " (" << AllocStats::allocations << " allocations): ";
+}
+
+void test_vector_range_ft() { range_construct<ft::vector<size_t, counting_allocator<size_t> > >(__FUNCTION__); }
+void test_vector_range_std() { range_construct<std::vector<size_t, counting_allocator<size_t> > >(__FUNCTION__); }
+
+template <typename TGrowth>
+void burst_and_drain(const char* name)
+{
+    AllocStats::current = AllocStats::peak = AllocStats::allocations = 0;
+    ft::vector<size_t, counting_allocator<size_t>, TGrowth> v;
+    size_t resident = 0;
+    for (size_t round = 0; round < 20; ++round)
+    {
+        for (size_t i = 0; i < 1'000'000; ++i)
+        {
+            v.push_back(i);
+        }
+        while (v.size() > 1000)
+        {
+            v.pop_back();
+        }
+        resident += AllocStats::current;
+    }
+    std::cout << name << ": peak " << AllocStats::peak / 1024 << " KB, after drain "
+              << resident / 20 / 1024 << " KB, " << AllocStats::allocations << " allocations, ";
+}
+
+void test_vector_drain_ft() { burst_and_drain<ft::growth_doubling>(__FUNCTION__); }
+void test_vector_drain_auto_shrink_ft() { burst_and_drain<ft::auto_shrink<> >(__FUNCTION__); }
+
+/// 256 MB of doubles: a sequential sum, then dependent random reads that miss the TLB on 4K pages
+template <typename TAlloc>
+void scan_doubles(const char* name)
+{
+    ft::vector<double, TAlloc> v(size_t(32 * 1024 * 1024), 1.0);
+    double sum = 0;
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        sum += v[i];
+    }
+    size_t idx = 0;
+    for (size_t i = 0; i < 10'000'000; ++i)
+    {
+        idx = (idx * 6364136223846793005ULL + 1442695040888963407ULL + static_cast<size_t>(v[idx % v.size()])) % v.size();
+        sum += v[idx];
+    }
+    std::cout << name << " (" << sum << "): ";
+}
+
+void test_vector_scan_std_alloc() { scan_doubles<std::allocator<double> >(__FUNCTION__); }
+void test_vector_scan_aligned_alloc() { scan_doubles<ft::aligned_allocator<double> >(__FUNCTION__); }
+void test_vector_scan_huge_page_alloc() { scan_doubles<ft::huge_page_allocator<double> >(__FUNCTION__); }
+
+/// Appends 20M entries and reports the slowest single push_back, where vector pays for the copy
+template <typename TContainer>
+void append_log(const char* name)
+{
+    TContainer log;
+    long long worst = 0;
+    for (size_t i = 0; i < 20'000'000; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        log.push_back(i);
+        auto end = std::chrono::steady_clock::now();
+        worst = std::max<long long>(worst, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+    }
+    std::cout << name << " (worst push_back " << worst << " us): ";
+}
+
+void test_vector_append_log_ft() { append_log<ft::vector<size_t> >(__FUNCTION__); }
+void test_segmented_vector_append_log_ft() { append_log<ft::segmented_vector<size_t> >(__FUNCTION__); }
+
+template <typename TAlloc>
+void intersect_and_scan(ft::vector<unsigned char, TAlloc>& lhs, const ft::vector<unsigned char, TAlloc>& rhs, size_t& members, size_t& walked)
+{
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        lhs[i] = lhs[i] && rhs[i];
+        members += lhs[i];
+    }
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        walked += lhs[i] ? i % 2 : 0;
+    }
+}
+
+template <typename TAlloc>
+void intersect_and_scan(ft::vector<bool, TAlloc>& lhs, const ft::vector<bool, TAlloc>& rhs, size_t& members, size_t& walked)
+{
+    lhs &= rhs;
+    members = lhs.count();
+    for (size_t i = lhs.find_first(); i != ft::vector<bool, TAlloc>::npos; i = lhs.find_next(i))
+    {
+        walked += i % 2;
+    }
+}
+
+/// 50M-entry membership bitmap: mark, intersect, then count and walk the members
+template <typename TBitmap>
+void bitmap_scan(const char* name)
+{
+    AllocStats::current = AllocStats::peak = AllocStats::allocations = 0;
+    const size_t entries = 50'000'000;
+    TBitmap sevens(entries, false);
+    TBitmap threes(entries, false);
+    for (size_t i = 0; i < entries; i += 7)
+    {
+        sevens[i] = true;
+    }
+    for (size_t i = 0; i < entries; i += 3)
+    {
+        threes[i] = true;
+    }
+    size_t members = 0;
+    size_t walked = 0;
+    intersect_and_scan(sevens, threes, members, walked);
+    std::cout << name << " (" << members << " members, " << walked << " walked, peak "
+              << AllocStats::peak / 1024 / 1024 << " MB): ";
+}
+
+void test_bitmap_bytes_ft() { bitmap_scan<ft::vector<unsigned char, counting_allocator<unsigned char> > >(__FUNCTION__); }
+void test_bitmap_packed_ft() { bitmap_scan<ft::vector<bool, counting_allocator<bool> > >(__FUNCTION__); }
+
+/// Ingests 20M generated records of 10 values each: one push_back per value,
+/// one append_n per record, or pushes batched through back_insert_buffer
+const size_t ingest_records = 2'000'000;
+const size_t ingest_width = 10;
+
+struct Sequence
+{
+    size_t next;
+
+    explicit Sequence(size_t start) : next(start) {}
+    size_t operator()() { return next++; }
+};
+
+void test_ingest_push_back_ft()
+{
+    ft::vector<size_t> v;
+    for (size_t r = 0; r < ingest_records; ++r)
+    {
+        for (size_t i = 0; i < ingest_width; ++i)
+        {
+            v.push_back(r * ingest_width + i);
+        }
+    }
+    std::cout << __FUNCTION__ << " (" << v.size() << "): ";
+}
+
+void test_ingest_append_n_ft()
+{
+    ft::vector<size_t> v;
+    for (size_t r = 0; r < ingest_records; ++r)
+    {
+        v.append_n(ingest_width, Sequence(r * ingest_width));
+    }
+    std::cout << __FUNCTION__ << " (" << v.size() << "): ";
+}
+
+void test_ingest_insert_buffer_ft()
+{
+    ft::vector<size_t> v;
+    {
+        ft::back_insert_buffer<ft::vector<size_t> > buffer(v);
+        for (size_t r = 0; r < ingest_records; ++r)
+        {
+            for (size_t i = 0; i < ingest_width; ++i)
+            {
+                buffer.push_back(r * ingest_width + i);
+            }
+        }
+        buffer.flush();
+    }
+    std::cout << __FUNCTION__ << " (" << v.size() << "): ";
+}
+
+/// Grows a vector of 1M small ft::vector<int>; ft::vector relocates them by memcpy,
+/// std::vector has to copy each one (ft::vector has no move constructor)
+template <typename TOuter>
+void grow_nested(const char* name)
+{
+    TOuter outer;
+    ft::vector<int> inner(size_t(8), 1);
+    for (size_t i = 0; i < 1'000'000; ++i)
+    {
+        outer.push_back(inner);
+    }
+    std::cout << name << ": ";
+}
+
+void test_vector_nested_grow_ft() { grow_nested<ft::vector<ft::vector<int> > >(__FUNCTION__); }
+void test_vector_nested_grow_std() { grow_nested<std::vector<ft::vector<int> > >(__FUNCTION__); }
+
+/// Times every push of 4M operator tokens: vector reallocation shows up as the worst-case
+/// push, while segment_stack allocates at most one chunk per push
+struct Token
+{
+    size_t kind;
+    size_t position;
+    double value;
+};
+
+template <typename TContainer>
+void push_latency(const char* name)
+{
+    const size_t count = 4'000'000;
+    std::vector<long long> latencies(count);
+    ft::stack<Token, TContainer> s;
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        s.push(Token{i % 7, i, 0.5});
+        auto end = std::chrono::steady_clock::now();
+        latencies[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    }
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << name << " push p50 " << latencies[count / 2] << " ns, p99.99 " << latencies[count - count / 10'000]
+              << " ns, max " << latencies.back() / 1000 << " us: ";
+}
+
+void test_stack_push_latency_vector_ft() { push_latency<ft::vector<Token> >(__FUNCTION__); }
+void test_stack_push_latency_segment_ft() { push_latency<ft::segment_stack<Token> >(__FUNCTION__); }
+
 void measure_func(const std::function<void()>& func)
 {
     auto start = std::chrono::steady_clock::now();
     func();
     auto end = std::chrono::steady_clock::now();
-    std::cout << std::chrono::duration_cast<std::chrono::seconds>(end - start).count() << " seconds" << std::endl;
+    std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
 }
 
 int main()
@@ -121,13 +678,76 @@ int main()
     measure_func(test_vector_ft);
     measure_func(test_vector_std);
 
+    measure_func(test_vector_int_grow_ft);
+    measure_func(test_vector_int_grow_std);
+    measure_func(test_vector_int_insert_ft);
+    measure_func(test_vector_int_insert_std);
+    measure_func(test_vector_int_erase_ft);
+    measure_func(test_vector_int_erase_std);
+    measure_func(test_vector_buffer_grow_ft);
+    measure_func(test_vector_buffer_grow_std);
+    measure_func(test_vector_buffer_copy_ft);
+    measure_func(test_vector_buffer_copy_std);
+
+    measure_func(test_vector_huge_grow_ft);
+    measure_func(test_vector_huge_grow_ft_malloc);
+    measure_func(test_vector_huge_grow_ft_page);
+
+    measure_func(test_growth_doubling);
+    measure_func(test_growth_one_and_half);
+    measure_func(test_growth_size_class);
+    measure_func(test_growth_exact);
+
+    measure_func(test_short_vector_ft);
+    measure_func(test_short_small_vector_ft);
+
+    measure_func(test_vector_refill_ft);
+
+    measure_func(test_vector_range_ft);
+    measure_func(test_vector_range_std);
+
+    measure_func(test_vector_drain_ft);
+    measure_func(test_vector_drain_auto_shrink_ft);
+
+    measure_func(test_vector_scan_std_alloc);
+    measure_func(test_vector_scan_aligned_alloc);
+    measure_func(test_vector_scan_huge_page_alloc);
+
+    measure_func(test_vector_append_log_ft);
+    measure_func(test_segmented_vector_append_log_ft);
+
+    measure_func(test_ingest_push_back_ft);
+    measure_func(test_ingest_append_n_ft);
+    measure_func(test_ingest_insert_buffer_ft);
+
+    measure_func(test_vector_nested_grow_ft);
+    measure_func(test_vector_nested_grow_std);
+
+    measure_func(test_bitmap_bytes_ft);
+    measure_func(test_bitmap_packed_ft);
+
+    measure_func(test_stack_vector_ft);
     measure_func(test_stack_ft);
     measure_func(test_stack_std);
+    measure_func(test_stack_buffer_vector_ft);
+    measure_func(test_stack_buffer_deque_ft);
+    measure_func(test_stack_push_latency_vector_ft);
+    measure_func(test_stack_push_latency_segment_ft);
 
     measure_func(test_map_ft);
     measure_func(test_map_std);
 
     measure_func(test_set_ft);
     measure_func(test_set_std);
+
+    measure_func(test_map_sweep_ft);
+    measure_func(test_map_erase_if_ft);
+
+    measure_func(test_multimap_append_ft);
+    measure_func(test_multimap_append_std);
+
+    measure_func(test_set_scan_ft);
+    measure_func(test_set_scan_ft_threaded);
+    measure_func(test_set_scan_std);
     return 0;
 }
@@ -0,0 +1,188 @@
+#include "vector.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+TEST(VectorBoolTests, PushBackAndAccess)
+{
+    ft::vector<bool> bits;
+    std::vector<bool> expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        bits.push_back(i % 3 == 0);
+        expected.push_back(i % 3 == 0);
+    }
+    ASSERT_EQ(bits.size(), 1000);
+    ASSERT_EQ(bits.capacity() % ft::vector<bool>::bits_per_word, 0);
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(bits[i], expected[i]);
+    }
+    bits[1] = true;
+    bits[0].flip();
+    ASSERT_TRUE(bits[1]);
+    ASSERT_FALSE(bits[0]);
+    bits[2] = bits[1];
+    ASSERT_TRUE(bits.at(2));
+    ASSERT_THROW(bits.at(1000), std::out_of_range);
+    bits.pop_back();
+    ASSERT_EQ(bits.size(), 999);
+    ASSERT_EQ(bits.word_count(), 16);
+}
+
+TEST(VectorBoolTests, Iterators)
+{
+    ft::vector<bool> bits(size_t(130), false);
+    ft::vector<bool>::iterator it = bits.begin() + 65;
+    *it = true;
+    ASSERT_TRUE(bits[65]);
+    ASSERT_EQ(it - bits.begin(), 65);
+    ASSERT_EQ(bits.end() - it, 65);
+    ASSERT_TRUE(*(bits.end() - 65));
+    it -= 66;
+    ASSERT_EQ(it - bits.begin(), -1);
+    ++it;
+    ASSERT_TRUE(it == bits.begin());
+
+    ft::vector<bool>::const_iterator cit = bits.begin();
+    size_t set_bits = 0;
+    for (; cit != bits.cend(); ++cit)
+    {
+        set_bits += *cit;
+    }
+    ASSERT_EQ(set_bits, 1);
+    ASSERT_FALSE(*bits.rbegin());
+
+    ft::vector<bool> copy(bits.begin(), bits.end());
+    ASSERT_TRUE(copy == bits);
+    copy[129] = true;
+    ASSERT_TRUE(copy != bits);
+    ASSERT_TRUE(bits < copy);
+}
+
+TEST(VectorBoolTests, CountAndFind)
+{
+    ft::vector<bool> bits(size_t(1000), false);
+    ASSERT_EQ(bits.find_first(), ft::vector<bool>::npos);
+    size_t positions[] = {3, 63, 64, 500, 999};
+    for (size_t i = 0; i < 5; ++i)
+    {
+        bits[positions[i]] = true;
+    }
+    ASSERT_EQ(bits.count(), 5);
+    size_t found = 0;
+    for (size_t pos = bits.find_first(); pos != ft::vector<bool>::npos; pos = bits.find_next(pos))
+    {
+        ASSERT_EQ(pos, positions[found++]);
+    }
+    ASSERT_EQ(found, 5);
+
+    bits.flip();
+    ASSERT_EQ(bits.count(), 995);
+    bits.resize(10);
+    ASSERT_EQ(bits.count(), 9);
+    bits.resize(200, true);
+    ASSERT_EQ(bits.count(), 199);
+    ASSERT_EQ(bits.find_first(), 0);
+    ASSERT_EQ(bits.find_next(2), 4);
+}
+
+TEST(VectorBoolTests, BulkOperations)
+{
+    ft::vector<bool> evens(size_t(300), false);
+    ft::vector<bool> thirds(size_t(300), false);
+    for (size_t i = 0; i < 300; ++i)
+    {
+        evens[i] = i % 2 == 0;
+        thirds[i] = i % 3 == 0;
+    }
+    ft::vector<bool> both(evens);
+    both &= thirds;
+    ft::vector<bool> any(evens);
+    any |= thirds;
+    ft::vector<bool> one(evens);
+    one ^= thirds;
+    for (size_t i = 0; i < 300; ++i)
+    {
+        ASSERT_EQ(both[i], i % 6 == 0);
+        ASSERT_EQ(any[i], i % 2 == 0 || i % 3 == 0);
+        ASSERT_EQ(one[i], (i % 2 == 0) != (i % 3 == 0));
+    }
+    both &= both;
+    ASSERT_EQ(both.count(), 50);
+    any |= any;
+    ASSERT_EQ(any.count(), 200);
+    one ^= one;
+    ASSERT_EQ(one.count(), 0);
+    ft::vector<bool> shorter(size_t(10), true);
+    ASSERT_THROW(shorter &= evens, std::invalid_argument);
+}
+
+TEST(VectorBoolTests, InsertErase)
+{
+    ft::vector<bool> bits;
+    std::vector<bool> expected;
+    for (int i = 0; i < 150; ++i)
+    {
+        bits.push_back(i % 5 == 0);
+        expected.push_back(i % 5 == 0);
+    }
+    bits.insert(bits.begin() + 7, 70, true);
+    expected.insert(expected.begin() + 7, 70, true);
+    bits.insert(bits.begin(), false);
+    expected.insert(expected.begin(), false);
+    bits.insert(bits.end() - 3, bits.begin(), bits.begin() + 10);
+    expected.insert(expected.end() - 3, expected.begin(), expected.begin() + 10);
+    bits.erase(bits.begin() + 60, bits.begin() + 130);
+    expected.erase(expected.begin() + 60, expected.begin() + 130);
+    bits.erase(bits.begin() + 1);
+    expected.erase(expected.begin() + 1);
+
+    ASSERT_EQ(bits.size(), expected.size());
+    size_t expected_count = 0;
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(bits[i], expected[i]);
+        expected_count += expected[i];
+    }
+    ASSERT_EQ(bits.count(), expected_count);
+
+    ASSERT_EQ(ft::erase_if(bits, [](bool bit) { return bit; }), expected_count);
+    ASSERT_EQ(bits.count(), 0);
+    ASSERT_EQ(bits.size(), expected.size() - expected_count);
+    bits.shrink_to_fit();
+    ASSERT_EQ(bits.capacity(), bits.word_count() * ft::vector<bool>::bits_per_word);
+}
+
+TEST(VectorBoolTests, ShiftsAcrossWordBoundaries)
+{
+    ft::vector<bool> bits;
+    std::vector<bool> expected;
+    for (int i = 0; i < 300; ++i)
+    {
+        bool bit = (i * 7 + i / 3) % 5 < 2;
+        bits.push_back(bit);
+        expected.push_back(bit);
+    }
+    const size_t positions[] = {0, 1, 63, 64, 65, 127, 130, 200};
+    const size_t counts[] = {1, 3, 63, 64, 65, 100};
+    for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); ++p)
+    {
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c)
+        {
+            bool val = (p + c) % 2 == 0;
+            bits.insert(bits.begin() + positions[p], counts[c], val);
+            expected.insert(expected.begin() + positions[p], counts[c], val);
+            size_t erased = counts[(c + 1) % (sizeof(counts) / sizeof(counts[0]))];
+            bits.erase(bits.begin() + positions[p] / 2, bits.begin() + positions[p] / 2 + erased);
+            expected.erase(expected.begin() + positions[p] / 2, expected.begin() + positions[p] / 2 + erased);
+            ASSERT_EQ(bits.size(), expected.size());
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                ASSERT_EQ(bits[i], expected[i]);
+            }
+            ASSERT_EQ(bits.count(), static_cast<size_t>(std::count(expected.begin(), expected.end(), true)));
+        }
+    }
+}
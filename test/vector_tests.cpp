@@ -1,6 +1,14 @@
 #include "vector.h"
+#include "map.h"
+#include "small_vector.h"
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+
 class VectorTests : public testing::Test
 {
 protected:
@@ -405,3 +413,505 @@ TEST_F(VectorTests, SwapMethod)
         ASSERT_EQ(ft_new_vec[i], std_vec[i]);
     }
 }
+
+TEST_F(VectorTests, EraseIf)
+{
+    ft::vector<int> ft_vec;
+    std::vector<int> expected;
+    for (int i = 0; i < 100; ++i)
+    {
+        ft_vec.push_back(i);
+        if (i % 3 != 0)
+        {
+            expected.push_back(i);
+        }
+    }
+
+    auto removed = ft::erase_if(ft_vec, [](int val) { return val % 3 == 0; });
+    ASSERT_EQ(removed, 34);
+    ASSERT_EQ(ft_vec.size(), expected.size());
+    ASSERT_TRUE(ft::equal(ft_vec.begin(), ft_vec.end(), expected.begin()));
+
+    ASSERT_EQ(ft::erase_if(ft_vec, [](int) { return false; }), 0);
+    ASSERT_EQ(ft::erase_if(ft_vec, [](int) { return true; }), expected.size());
+    ASSERT_TRUE(ft_vec.empty());
+}
+
+TEST_F(VectorTests, InsertEraseNonTrivial)
+{
+    ft::vector<std::string> ft_vec;
+    std::vector<std::string> std_vec_str;
+    for (int i = 0; i < 20; ++i)
+    {
+        ft_vec.insert(ft_vec.begin() + ft_vec.size() / 2, 2, std::string(30, 'a' + i));
+        std_vec_str.insert(std_vec_str.begin() + std_vec_str.size() / 2, 2, std::string(30, 'a' + i));
+    }
+    ft_vec.erase(ft_vec.begin() + 3, ft_vec.begin() + 11);
+    std_vec_str.erase(std_vec_str.begin() + 3, std_vec_str.begin() + 11);
+    ft_vec.erase(ft_vec.begin());
+    std_vec_str.erase(std_vec_str.begin());
+
+    ft::vector<std::string> copy(ft_vec);
+    ASSERT_EQ(copy.size(), std_vec_str.size());
+    ASSERT_TRUE(ft::equal(copy.begin(), copy.end(), std_vec_str.begin()));
+}
+
+TEST_F(VectorTests, InsertOwnElement)
+{
+    ft::vector<int> ft_vec(std_vec.begin(), std_vec.end());
+    ft_vec.reserve(10);
+    ft_vec.insert(ft_vec.begin(), 2, ft_vec[1]);
+    ft_vec.insert(ft_vec.begin(), 5, ft_vec.back());
+
+    std::vector<int> expected = {3, 3, 3, 3, 3, 2, 2, 1, 2, 3};
+    ASSERT_EQ(ft_vec.size(), expected.size());
+    ASSERT_TRUE(ft::equal(ft_vec.begin(), ft_vec.end(), expected.begin()));
+}
+
+template <typename TGrowth>
+void check_growth_policy()
+{
+    ft::vector<int, std::allocator<int>, TGrowth> v;
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(i);
+        ASSERT_GE(v.capacity(), v.size());
+    }
+    v.resize(1500, 7);
+    ASSERT_GE(v.capacity(), 1500);
+    v.insert(v.begin(), 600, 3);
+    ASSERT_EQ(v.size(), 2100);
+    ASSERT_GE(v.capacity(), 2100);
+    ASSERT_EQ(v[599], 3);
+    ASSERT_EQ(v[600], 0);
+    ASSERT_EQ(v.back(), 7);
+}
+
+TEST_F(VectorTests, GrowthPolicies)
+{
+    check_growth_policy<ft::growth_doubling>();
+    check_growth_policy<ft::growth_one_and_half>();
+    check_growth_policy<ft::growth_size_class>();
+    check_growth_policy<ft::growth_exact>();
+
+    ft::vector<int> from_empty;
+    from_empty.resize(5);
+    ASSERT_EQ(from_empty.capacity(), 5);
+    from_empty.resize(7);
+    ASSERT_EQ(from_empty.capacity(), 10);
+
+    ft::vector<int, std::allocator<int>, ft::growth_exact> exact;
+    exact.assign(static_cast<size_t>(9), 1);
+    ASSERT_EQ(exact.capacity(), 9);
+
+    ASSERT_EQ(ft::growth_size_class::round_to_class(17), 32);
+    ASSERT_EQ(ft::growth_size_class::round_to_class(129), 160);
+    ASSERT_EQ(ft::growth_size_class::next_capacity(0, 3, 4), 4);
+}
+
+TEST_F(VectorTests, ResizeWithinCapacity)
+{
+    ft::vector<int> ft_vec;
+    ft_vec.reserve(10);
+    ft_vec.resize(4, 9);
+    ASSERT_EQ(ft_vec.size(), 4);
+    ASSERT_EQ(ft_vec[3], 9);
+}
+
+namespace
+{
+
+struct DefaultFive
+{
+    int x = 5;
+};
+
+}
+
+TEST_F(VectorTests, ResizeDefaultInit)
+{
+    ft::vector<char> buffer;
+    buffer.push_back('a');
+    buffer.resize_default_init(100);
+    ASSERT_EQ(buffer.size(), 100);
+    ASSERT_EQ(buffer[0], 'a');
+
+    char* tail = buffer.append_uninitialized(5);
+    ASSERT_EQ(tail, &buffer[100]);
+    std::memcpy(tail, "hello", 5);
+    ASSERT_EQ(buffer.size(), 105);
+    ASSERT_EQ(buffer.back(), 'o');
+
+    buffer.resize_default_init(1);
+    ASSERT_EQ(buffer.size(), 1);
+
+    ft::vector<std::string> strings;
+    strings.resize_default_init(3);
+    ASSERT_EQ(strings.size(), 3);
+    ASSERT_TRUE(strings[2].empty());
+
+    ft::vector<DefaultFive> fives; /// trivially copyable, but its default constructor does work
+    fives.resize_default_init(3);
+    ASSERT_EQ(fives[2].x, 5);
+}
+
+TEST_F(VectorTests, DefaultInitAllocator)
+{
+    std::vector<int, ft::default_init_allocator<int> > v(3, 7);
+    v.resize(10);
+    ASSERT_EQ(v.size(), 10);
+    ASSERT_EQ(v[2], 7);
+
+    std::vector<std::string, ft::default_init_allocator<std::string> > strings;
+    strings.resize(2);
+    strings.emplace_back("x");
+    ASSERT_TRUE(strings[1].empty());
+    ASSERT_EQ(strings[2], "x");
+}
+
+TEST_F(VectorTests, AssignReusesStorage)
+{
+    ft::vector<std::string> scratch;
+    ft::vector<std::string> big(static_cast<size_t>(8), std::string(40, 'b'));
+    ft::vector<std::string> small(static_cast<size_t>(3), std::string(40, 's'));
+
+    scratch = big;
+    ASSERT_EQ(scratch, big);
+    const std::string* data = &scratch[0];
+    size_t capacity = scratch.capacity();
+
+    scratch = small;
+    ASSERT_EQ(scratch, small);
+    scratch.assign(static_cast<size_t>(6), std::string("x"));
+    ASSERT_EQ(scratch.size(), 6);
+    ASSERT_EQ(scratch[5], "x");
+    scratch.assign(big.begin(), big.begin() + 7);
+    ASSERT_EQ(scratch.size(), 7);
+    ASSERT_EQ(scratch[6], big[6]);
+    scratch.assign(static_cast<size_t>(2), scratch[1]);
+    ASSERT_EQ(scratch.size(), 2);
+    ASSERT_EQ(scratch[0], big[1]);
+
+    ASSERT_EQ(&scratch[0], data);
+    ASSERT_EQ(scratch.capacity(), capacity);
+}
+
+TEST_F(VectorTests, IteratorCategories)
+{
+    ft::vector<int> filled(5, 3);
+    ASSERT_EQ(filled.size(), 5);
+    ASSERT_EQ(filled[4], 3);
+
+    std::list<int> lst = {1, 2, 3, 4};
+    ft::vector<int> from_list(lst.begin(), lst.end());
+    ASSERT_EQ(from_list.capacity(), 4);
+    ASSERT_TRUE(ft::equal(from_list.begin(), from_list.end(), lst.begin()));
+
+    std::istringstream in("5 6 7");
+    ft::vector<int> from_stream((std::istream_iterator<int>(in)), std::istream_iterator<int>());
+    ASSERT_EQ(from_stream.size(), 3);
+    ASSERT_EQ(from_stream.back(), 7);
+
+    int raw[] = {8, 9};
+    from_list.insert(from_list.begin() + 1, raw, raw + 2);
+    std::istringstream more("10 11");
+    from_list.insert(from_list.end(), std::istream_iterator<int>(more), std::istream_iterator<int>());
+    from_list.insert(from_list.begin(), std_vec.begin(), std_vec.end());
+    std::vector<int> expected = {1, 2, 3, 1, 8, 9, 2, 3, 4, 10, 11};
+    ASSERT_EQ(from_list.size(), expected.size());
+    ASSERT_TRUE(ft::equal(from_list.begin(), from_list.end(), expected.begin()));
+
+    std::istringstream shorter("1 2");
+    from_list.assign(std::istream_iterator<int>(shorter), std::istream_iterator<int>());
+    ASSERT_EQ(from_list.size(), 2);
+    std::istringstream longer("1 2 3 4 5 6 7 8 9 10 11 12 13");
+    from_list.assign(std::istream_iterator<int>(longer), std::istream_iterator<int>());
+    ASSERT_EQ(from_list.size(), 13);
+    ASSERT_EQ(from_list.back(), 13);
+
+    from_list.assign(lst.begin(), lst.end());
+    ASSERT_TRUE(ft::equal(from_list.begin(), from_list.end(), lst.begin()));
+}
+
+TEST_F(VectorTests, ShrinkToFit)
+{
+    ft::vector<std::string> strings(size_t(100), "shrink");
+    strings.resize(10);
+    ASSERT_EQ(strings.capacity(), 100);
+    strings.shrink_to(50);
+    ASSERT_EQ(strings.capacity(), 50);
+    strings.shrink_to(5);
+    ASSERT_EQ(strings.capacity(), 10);
+    strings.shrink_to(80);
+    ASSERT_EQ(strings.capacity(), 10);
+    strings.shrink_to_fit();
+    ASSERT_EQ(strings.capacity(), 10);
+    ASSERT_EQ(strings.back(), "shrink");
+
+    ft::vector<int, ft::malloc_allocator<int> > ints(size_t(1000), 7);
+    ints.erase(ints.begin() + 3, ints.end());
+    ints.shrink_to_fit();
+    ASSERT_EQ(ints.capacity(), 3);
+    ASSERT_EQ(ints[2], 7);
+    ints.clear();
+    ints.shrink_to_fit();
+    ASSERT_EQ(ints.capacity(), 0);
+    ints.push_back(1);
+    ASSERT_EQ(ints.back(), 1);
+}
+
+TEST_F(VectorTests, AutoShrink)
+{
+    ft::vector<int, std::allocator<int>, ft::auto_shrink<> > v;
+    for (int i = 0; i < 64; ++i)
+    {
+        v.push_back(i);
+    }
+    ASSERT_EQ(v.capacity(), 64);
+    v.erase(v.begin() + 16, v.end());
+    ASSERT_EQ(v.capacity(), 64);
+    v.pop_back();
+    ASSERT_EQ(v.capacity(), 30);
+    ASSERT_EQ(v.back(), 14);
+    v.resize(3);
+    ASSERT_EQ(v.capacity(), 6);
+    v.resize(0);
+    ASSERT_EQ(v.capacity(), 0);
+
+    ft::vector<int> plain(size_t(64), 1);
+    plain.resize(1);
+    ASSERT_EQ(plain.capacity(), 64);
+}
+
+namespace
+{
+
+/// Copies throw once copies_left runs out; live counts constructed minus destroyed objects
+struct ThrowingCopy
+{
+    static int live;
+    static int copies_left;
+
+    int value;
+
+    ThrowingCopy(int v = 0) : value(v) { ++live; }
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+    {
+        if (copies_left-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+        ++live;
+    }
+    ThrowingCopy& operator=(const ThrowingCopy& other) { value = other.value; return *this; }
+    ~ThrowingCopy() { --live; }
+};
+
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = -1;
+
+}
+
+TEST_F(VectorTests, StrongGuaranteeOnGrowth)
+{
+    ThrowingCopy::copies_left = -1;
+    {
+        ft::vector<ThrowingCopy> v;
+        v.reserve(4);
+        for (int i = 0; i < 4; ++i)
+        {
+            v.push_back(ThrowingCopy(i));
+        }
+        ThrowingCopy* data = &v[0];
+
+        ThrowingCopy::copies_left = 2;
+        ASSERT_THROW(v.reserve(16), std::runtime_error);
+        ASSERT_EQ(v.capacity(), 4);
+        ASSERT_EQ(&v[0], data);
+        ASSERT_EQ(ThrowingCopy::live, 4);
+
+        int values[] = {10, 11, 12};
+        ThrowingCopy::copies_left = 2;
+        ASSERT_THROW(v.insert(v.begin() + 1, values, values + 3), std::runtime_error);
+        ThrowingCopy::copies_left = 3;
+        ASSERT_THROW(v.insert(v.begin() + 2, 3, ThrowingCopy(7)), std::runtime_error);
+        ASSERT_EQ(v.size(), 4);
+        ASSERT_EQ(&v[0], data);
+        for (int i = 0; i < 4; ++i)
+        {
+            ASSERT_EQ(v[i].value, i);
+        }
+        ASSERT_EQ(ThrowingCopy::live, 4);
+
+        ThrowingCopy::copies_left = 1;
+        ASSERT_THROW(ft::vector<ThrowingCopy> copy(v), std::runtime_error);
+        ASSERT_EQ(ThrowingCopy::live, 4);
+        ThrowingCopy::copies_left = -1;
+    }
+    ASSERT_EQ(ThrowingCopy::live, 0);
+}
+
+TEST_F(VectorTests, BasicGuaranteeOnShift)
+{
+    ThrowingCopy::copies_left = -1;
+    {
+        ft::vector<ThrowingCopy> v;
+        v.reserve(16);
+        for (int i = 0; i < 8; ++i)
+        {
+            v.push_back(ThrowingCopy(i));
+        }
+
+        ThrowingCopy::copies_left = 3;
+        ASSERT_THROW(v.erase(v.begin() + 1), std::runtime_error);
+        ASSERT_EQ(static_cast<int>(v.size()), ThrowingCopy::live);
+        for (size_t i = 0; i < v.size(); ++i)
+        {
+            ASSERT_EQ(v[i].value, static_cast<int>(i < 1 ? i : i + 1));
+        }
+
+        ThrowingCopy::copies_left = 1;
+        ASSERT_THROW(v.insert(v.begin(), ThrowingCopy(9)), std::runtime_error);
+        ASSERT_EQ(static_cast<int>(v.size()), ThrowingCopy::live);
+
+        ThrowingCopy::copies_left = -1;
+        v.push_back(ThrowingCopy(5));
+        ASSERT_EQ(v.back().value, 5);
+        ASSERT_EQ(static_cast<int>(v.size()), ThrowingCopy::live);
+    }
+    ASSERT_EQ(ThrowingCopy::live, 0);
+}
+
+TEST_F(VectorTests, InCapacityInsertKeepsTail)
+{
+    ThrowingCopy::copies_left = -1;
+    {
+        ft::vector<ThrowingCopy> v;
+        v.reserve(16);
+        for (int i = 0; i < 4; ++i)
+        {
+            v.push_back(ThrowingCopy(i));
+        }
+        ThrowingCopy* data = &v[0];
+
+        ThrowingCopy::copies_left = 4; /// three shifted elements, then the second copy into the gap fails
+        ASSERT_THROW(v.insert(v.begin() + 1, 3, ThrowingCopy(7)), std::runtime_error);
+        ThrowingCopy range[] = {ThrowingCopy(10), ThrowingCopy(11)};
+        ThrowingCopy::copies_left = 3; /// two shifted elements, then the second range copy fails
+        ASSERT_THROW(v.insert(v.begin() + 2, range, range + 2), std::runtime_error);
+        ThrowingCopy::copies_left = -1;
+
+        ASSERT_EQ(v.size(), 4);
+        ASSERT_EQ(&v[0], data);
+        for (int i = 0; i < 4; ++i)
+        {
+            ASSERT_EQ(v[i].value, i);
+        }
+        ASSERT_EQ(ThrowingCopy::live, 6);
+    }
+    ASSERT_EQ(ThrowingCopy::live, 0);
+}
+
+namespace
+{
+
+struct Counter
+{
+    int next;
+
+    Counter() : next(0) {}
+    int operator()() { return next++; }
+};
+
+struct ThrowingCounter : Counter
+{
+    ThrowingCopy operator()() { return ThrowingCopy(next++); }
+};
+
+}
+
+TEST_F(VectorTests, Append)
+{
+    ft::vector<int> v(size_t(2), 9);
+    int raw[] = {1, 2, 3};
+    v.append(raw, raw + 3);
+    ASSERT_EQ(v.size(), 5);
+    ASSERT_EQ(v[2], 1);
+    ASSERT_EQ(v.back(), 3);
+
+    v.append(v.begin(), v.end());
+    ASSERT_EQ(v.size(), 10);
+    ASSERT_EQ(v[5], 9);
+    ASSERT_EQ(v[9], 3);
+
+    std::istringstream stream("4 5 6");
+    v.append(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+    ASSERT_EQ(v.size(), 13);
+    ASSERT_EQ(v.back(), 6);
+
+    std::list<std::string> words(3, "word");
+    ft::vector<std::string> strings;
+    strings.append(words.begin(), words.end());
+    ASSERT_EQ(strings.size(), 3);
+    ASSERT_EQ(strings[2], "word");
+}
+
+TEST_F(VectorTests, AppendN)
+{
+    ft::vector<int> v;
+    v.push_back(-1);
+    v.append_n(1000, Counter());
+    ASSERT_EQ(v.size(), 1001);
+    ASSERT_EQ(v[1], 0);
+    ASSERT_EQ(v.back(), 999);
+    v.append_n(0, Counter());
+    ASSERT_EQ(v.size(), 1001);
+
+    ThrowingCopy::copies_left = -1;
+    {
+        ft::vector<ThrowingCopy> objects;
+        objects.reserve(8);
+        objects.push_back(ThrowingCopy(1));
+        ThrowingCopy::copies_left = 2;
+        ASSERT_THROW(objects.append_n(5, ThrowingCounter()), std::runtime_error);
+        ThrowingCopy::copies_left = -1;
+        ASSERT_EQ(objects.size(), 1);
+        ASSERT_EQ(ThrowingCopy::live, 1);
+    }
+    ASSERT_EQ(ThrowingCopy::live, 0);
+}
+
+TEST_F(VectorTests, TriviallyRelocatable)
+{
+    ASSERT_TRUE(ft::is_trivially_relocatable<int>::value);
+    ASSERT_TRUE(ft::is_trivially_relocatable<ft::vector<std::string> >::value);
+    ASSERT_TRUE((ft::is_trivially_relocatable<ft::map<int, std::string> >::value));
+    ASSERT_FALSE((ft::is_trivially_relocatable<ft::small_vector<int, 4> >::value));
+    ASSERT_FALSE(ft::is_trivially_relocatable<ThrowingCopy>::value);
+
+    ft::vector<ft::vector<int> > nested;
+    nested.push_back(ft::vector<int>(size_t(100), 1));
+    nested.push_back(ft::vector<int>(size_t(100), 2));
+    int* inner = &nested[1][0];
+    nested.reserve(64);
+    ASSERT_EQ(&nested[1][0], inner); /// moved by memcpy, not deep copied
+    nested.insert(nested.begin(), size_t(70), nested[1]);
+    ASSERT_EQ(nested.size(), 72);
+    ASSERT_EQ(&nested[71][0], inner);
+    ASSERT_EQ(nested[0][99], 2);
+    nested.erase(nested.begin(), nested.begin() + 70);
+    ASSERT_EQ(&nested[1][0], inner);
+    ASSERT_EQ(nested[0][0], 1);
+
+    ft::vector<ft::map<int, std::string> > maps(size_t(3));
+    maps[2][7] = "seven";
+    for (int i = 0; i < 100; ++i)
+    {
+        maps.push_back(maps[2]);
+    }
+    maps.insert(maps.begin() + 1, maps.begin() + 2, maps.begin() + 4);
+    ASSERT_EQ(maps.size(), 105);
+    ASSERT_EQ(maps[1][7], "seven");
+    ASSERT_EQ(maps.back().find(7)->second, "seven");
+    ASSERT_TRUE(maps[0].empty());
+}